@@ -0,0 +1,124 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberAnalyticEvaluator.hpp"
+
+#include <algorithm>
+
+namespace wsf
+{
+namespace cyber
+{
+
+// =================================================================================================
+double AnalyticEvaluator::GetProbability(double aThreshold)
+{
+   //! Draws are uniform in [0, 1), and succeed if the draw does not exceed the threshold.
+   return std::min(std::max(aThreshold, 0.0), 1.0);
+}
+
+// =================================================================================================
+AnalyticEvaluator::ScanOutcome AnalyticEvaluator::EvaluateScan(const Engagement& aEngagement)
+{
+   ScanOutcome outcome;
+   outcome.mTimeScan = aEngagement.GetScanDelayTime();
+   if (aEngagement.IsVictimImmune())
+   {
+      outcome.mBlockedReason = Engagement::cSCAN_IMMUNITY;
+      return outcome;
+   }
+
+   //! A detected scan fails, and may be attributed.
+   outcome.mProbabilityDetected   = GetProbability(aEngagement.GetScanDetectionThreshold());
+   outcome.mProbabilityAttributed =
+      outcome.mProbabilityDetected * GetProbability(aEngagement.GetScanAttributionThreshold());
+   outcome.mProbabilitySuccess = 1.0 - outcome.mProbabilityDetected;
+   return outcome;
+}
+
+// =================================================================================================
+AnalyticEvaluator::AttackOutcome AnalyticEvaluator::EvaluateAttack(Engagement& aEngagement)
+{
+   AttackOutcome outcome;
+   outcome.mTimeExploit          = aEngagement.GetDeliveryDelayTime();
+   outcome.mExpectedTimeComplete = outcome.mTimeExploit;
+   if (aEngagement.IsVictimImmune())
+   {
+      outcome.mBlockedReason = Engagement::cATTACK_IMMUNITY;
+      return outcome;
+   }
+   if (aEngagement.ExistingConstraintReservations() || !aEngagement.MeetsAttackerConstraints())
+   {
+      outcome.mBlockedReason = Engagement::cATTACK_INSUFFICIENT_RESOURCES;
+      return outcome;
+   }
+
+   double success        = GetProbability(aEngagement.GetAttackSuccessThreshold());
+   double detected       = GetProbability(aEngagement.GetAttackDetectionThreshold());
+   double duration       = aEngagement.GetDuration();
+   double detectionDelay = aEngagement.GetAttackDetectionDelayTime();
+   double recoveryDelay  = aEngagement.GetAttackRecoveryDelayTime();
+   bool   hasDuration    = (duration > 0.0);
+
+   //! The status report is drawn for both successful and failed attacks.
+   outcome.mProbabilitySuccess        = success;
+   outcome.mProbabilityStatusReported = GetProbability(aEngagement.GetStatusReportThreshold());
+
+   //! A detected attack reaches the detection phase unless the attack duration ends first,
+   //! in which case the attack proceeds directly to recovery.
+   bool   detectionPhase         = !(hasDuration && (detectionDelay > 0.0) && (detectionDelay > duration));
+   double timeRecoveryIfDetected = outcome.mTimeExploit + duration;
+   if (detectionPhase)
+   {
+      //! The time remaining in the attack is measured from the initiation of the attack.
+      outcome.mTimeDetection = outcome.mTimeExploit + detectionDelay;
+      double attackTimeLeft  = duration - outcome.mTimeDetection;
+      timeRecoveryIfDetected = outcome.mTimeDetection;
+      if (recoveryDelay != 0.0)
+      {
+         timeRecoveryIfDetected += (hasDuration && (attackTimeLeft < recoveryDelay)) ? attackTimeLeft : recoveryDelay;
+      }
+
+      outcome.mProbabilityDetected   = success * detected;
+      outcome.mProbabilityAttributed =
+         outcome.mProbabilityDetected * GetProbability(aEngagement.GetAttackAttributionThreshold());
+   }
+
+   //! An undetected attack only reaches the recovery phase at the end of its duration, if any.
+   double recoveryPhase     = success * (detected + (hasDuration ? (1.0 - detected) : 0.0));
+   double timeRecoveryPhase = 0.0;
+   if (recoveryPhase > 0.0)
+   {
+      timeRecoveryPhase = ((success * detected * timeRecoveryIfDetected) +
+                           (hasDuration ? (success * (1.0 - detected) * (outcome.mTimeExploit + duration)) : 0.0)) /
+                          recoveryPhase;
+   }
+
+   //! Recovery occurs in the recovery phase only if restoration is defined or the attack has a duration.
+   //! Immunity is only drawn on recovery if the duration does not end prior to detection.
+   if (aEngagement.GetRecovery() || hasDuration)
+   {
+      outcome.mProbabilityRecovered = recoveryPhase;
+      outcome.mTimeRecovery         = timeRecoveryPhase;
+      if (!hasDuration || (duration >= detectionDelay))
+      {
+         outcome.mProbabilityImmunity = recoveryPhase * GetProbability(aEngagement.GetImmunityThreshold());
+      }
+   }
+
+   //! The attempt completes at the exploit, unless the recovery phase is reached.
+   outcome.mExpectedTimeComplete = ((1.0 - recoveryPhase) * outcome.mTimeExploit) + (recoveryPhase * timeRecoveryPhase);
+   return outcome;
+}
+
+} // namespace cyber
+} // namespace wsf
@@ -0,0 +1,77 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERANALYTICEVALUATOR_HPP
+#define WSFCYBERANALYTICEVALUATOR_HPP
+
+#include "wsf_cyber_export.h"
+
+#include "WsfCyberEngagement.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! Provides the exact outcome probabilities and timings of a scan or attack attempt, as modeled by
+//! the EngagementManager, without performing any draws. The thresholds, delays and duration of the
+//! engagement are used, and each draw is assumed to succeed with the probability of its threshold.
+//!
+//! Conditions that do not depend on a draw (victim immunity, attacker resources) are evaluated using
+//! the current state of the engagement. If such a condition prevents the attempt, every probability
+//! is zero and the reason is provided. User defined "IsVulnerable" scripts are not executed, and the
+//! victim is assumed to be vulnerable.
+//!
+//! All times are relative to the initiation of the attempt. Times associated with a branch are the
+//! times at which that branch occurs, given that it occurs.
+class WSF_CYBER_EXPORT AnalyticEvaluator
+{
+public:
+   struct ScanOutcome
+   {
+      Engagement::CyberScanFailure mBlockedReason{Engagement::cSCAN_NONE};
+      double                       mProbabilitySuccess{0.0};
+      double                       mProbabilityDetected{0.0};
+      double                       mProbabilityAttributed{0.0};
+      double                       mTimeScan{0.0};
+   };
+
+   struct AttackOutcome
+   {
+      Engagement::CyberAttackFailure mBlockedReason{Engagement::cATTACK_NONE};
+      double                         mProbabilitySuccess{0.0};
+      double                         mProbabilityStatusReported{0.0};
+      double                         mProbabilityDetected{0.0};
+      double                         mProbabilityAttributed{0.0};
+      double                         mProbabilityRecovered{0.0};
+      double                         mProbabilityImmunity{0.0};
+
+      //! The time of the exploit (success or failure), detection and recovery.
+      double mTimeExploit{0.0};
+      double mTimeDetection{0.0};
+      double mTimeRecovery{0.0};
+
+      //! The expected time at which the attempt is complete, over all branches.
+      double mExpectedTimeComplete{0.0};
+   };
+
+   //! Returns the probability that a draw against the threshold succeeds.
+   static double GetProbability(double aThreshold);
+
+   static ScanOutcome   EvaluateScan(const Engagement& aEngagement);
+   static AttackOutcome EvaluateAttack(Engagement& aEngagement);
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
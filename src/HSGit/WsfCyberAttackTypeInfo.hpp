@@ -0,0 +1,112 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFCYBERATTACKTYPEINFO_HPP
+#define WSFCYBERATTACKTYPEINFO_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "WsfCyberAttack.hpp"
+#include "WsfCyberEffectTypes.hpp"
+#include "WsfStringId.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! Immutable data associated with an attack type, resolved once per simulation by the
+//! engagement manager and shared by every engagement using the attack type. This allows
+//! engagements to use attack type data without any scenario level lookups.
+//! @note The attack referenced is the attack type defined in the scenario, and is not modified.
+//! Engagements share the prototype, a single copy of this attack, rather than each maintaining a copy.
+class WSF_CYBER_EXPORT AttackTypeInfo
+{
+public:
+   //! The data required to instantiate a single effect, resolved once per effect type.
+   //! The prototype is the effect type defined in the scenario, or nullptr if no
+   //! such effect type exists.
+   struct EffectPlanEntry
+   {
+      EffectPlanEntry(const std::string& aName, const EffectTypes& aEffectTypes)
+         : mName(aName)
+         , mNameId(aName)
+         , mPrototypePtr(aEffectTypes.Find(aName))
+         , mInputRequirement(mPrototypePtr ? mPrototypePtr->RequiredInput() : Effect::InputRequirement::cNOT_ALLOWED)
+      {
+      }
+
+      std::string              mName;
+      WsfStringId              mNameId;
+      const Effect*            mPrototypePtr;
+      Effect::InputRequirement mInputRequirement;
+   };
+
+   //! Indexed by effect slot, corresponding to the order of the attack type effects.
+   using EffectPlan = std::vector<EffectPlanEntry>;
+
+   AttackTypeInfo(const Attack& aAttack, const std::string& aName, size_t aId, const EffectTypes& aEffectTypes)
+      : mAttack(aAttack)
+      , mName(aName)
+      , mNameId(aName)
+      , mPrototypePtr(aAttack.Clone())
+      , mId(aId)
+      , mResourceRequirements(aAttack.GetResourceRequirements())
+      , mTimeDelayScan(aAttack.GetTimeDelayScan())
+      , mTimeDelayDelivery(aAttack.GetTimeDelayDelivery())
+      , mDuration(aAttack.GetDuration())
+      , mEffects(aAttack.GetEffects())
+   {
+      mEffectPlan.reserve(mEffects.size());
+      for (const auto& effect : mEffects)
+      {
+         mEffectPlan.emplace_back(effect, aEffectTypes);
+      }
+   }
+
+   ~AttackTypeInfo()                          = default;
+   AttackTypeInfo(const AttackTypeInfo& aSrc) = delete;
+   AttackTypeInfo& operator=(const AttackTypeInfo& aRhs) = delete;
+
+   const Attack&                   GetAttack() const { return mAttack; }
+   std::shared_ptr<const Attack>   GetPrototype() const { return mPrototypePtr; }
+   const std::string&              GetName() const { return mName; }
+   WsfStringId                     GetNameId() const { return mNameId; }
+   size_t                          GetId() const { return mId; }
+   double                          GetResourceRequirements() const { return mResourceRequirements; }
+   double                          GetTimeDelayScan() const { return mTimeDelayScan; }
+   double                          GetTimeDelayDelivery() const { return mTimeDelayDelivery; }
+   double                          GetDuration() const { return mDuration; }
+   const std::vector<std::string>& GetEffects() const { return mEffects; }
+   const EffectPlan&               GetEffectPlan() const { return mEffectPlan; }
+
+private:
+   const Attack&                 mAttack;
+   std::string                   mName;
+   WsfStringId                   mNameId;
+   std::shared_ptr<const Attack> mPrototypePtr;
+   size_t                        mId;
+   double                        mResourceRequirements;
+   double                        mTimeDelayScan;
+   double                        mTimeDelayDelivery;
+   double                        mDuration;
+   std::vector<std::string>      mEffects;
+   EffectPlan                    mEffectPlan;
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
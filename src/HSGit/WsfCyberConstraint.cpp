@@ -93,7 +93,7 @@ bool wsf::cyber::Constraint::ProcessInput(UtInput& aInput)
    return myCommand;
 }
 
-size_t Constraint::GetConcurrentAttacks(const std::string& aAttackType) const
+size_t Constraint::GetConcurrentAttacks(WsfStringId aAttackType) const
 {
    size_t concurrentAttacks = 0;
 
@@ -107,12 +107,12 @@ size_t Constraint::GetConcurrentAttacks(const std::string& aAttackType) const
    return concurrentAttacks;
 }
 
-void Constraint::AddConcurrentAttack(const std::string& aAttackType, size_t aEngagementID)
+void Constraint::AddConcurrentAttack(WsfStringId aAttackType, size_t aEngagementID)
 {
    mAttackData[aAttackType].mConcurrentEngagements.push_back(aEngagementID);
 }
 
-void Constraint::RemoveConcurrentAttack(const std::string& aAttackType, size_t aEngagementID)
+void Constraint::RemoveConcurrentAttack(WsfStringId aAttackType, size_t aEngagementID)
 {
    auto attackList = mAttackData.find(aAttackType);
 
@@ -133,12 +133,12 @@ void Constraint::RemoveConcurrentAttack(const std::string& aAttackType, size_t a
    }
 }
 
-void Constraint::AddAttackTime(const std::string& aAttackType, double aSimTime)
+void Constraint::AddAttackTime(WsfStringId aAttackType, double aSimTime)
 {
    mAttackData[aAttackType].mAttackTimes.insert(aSimTime);
 }
 
-size_t Constraint::GetAttackCountAfterTime(const std::string& aAttackType, double aSimTime) const
+size_t Constraint::GetAttackCountAfterTime(WsfStringId aAttackType, double aSimTime) const
 {
    auto& attackTimes = mAttackData.at(aAttackType).mAttackTimes;
 
@@ -25,6 +25,7 @@
 #include "WsfObject.hpp"
 #include "WsfObjectTypeList.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfStringId.hpp"
 #include "script/WsfScriptObjectClass.hpp"
 
 namespace wsf
@@ -58,11 +59,11 @@ public:
 
    //! @name External C2 monitoring methods.
    //@{
-   size_t GetConcurrentAttacks(const std::string& aAttackType) const;
-   void   AddConcurrentAttack(const std::string& aAttackType, size_t aEngagementID);
-   void   RemoveConcurrentAttack(const std::string& aAttackType, size_t aEngagementID);
-   void   AddAttackTime(const std::string& aAttackType, double aSimTime);
-   size_t GetAttackCountAfterTime(const std::string& aAttackType, double aSimTime) const;
+   size_t GetConcurrentAttacks(WsfStringId aAttackType) const;
+   void   AddConcurrentAttack(WsfStringId aAttackType, size_t aEngagementID);
+   void   RemoveConcurrentAttack(WsfStringId aAttackType, size_t aEngagementID);
+   void   AddAttackTime(WsfStringId aAttackType, double aSimTime);
+   size_t GetAttackCountAfterTime(WsfStringId aAttackType, double aSimTime) const;
    //@}
 
    //! @name Cyber resource methods
@@ -82,7 +83,8 @@ private:
       std::multiset<double> mAttackTimes;
    };
 
-   std::map<std::string, AttackInfo> mAttackData;
+   //! Keyed by the string identifier of the attack type, avoiding string comparisons.
+   std::map<WsfStringId, AttackInfo> mAttackData;
 
    double mResources{0.0};
    double mTotalResources{0.0};
@@ -0,0 +1,99 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberCounterRandom.hpp"
+
+namespace
+{
+constexpr std::uint32_t cMULTIPLIER_0    = 0xD2511F53U;
+constexpr std::uint32_t cMULTIPLIER_1    = 0xCD9E8D57U;
+constexpr std::uint32_t cKEY_INCREMENT_0 = 0x9E3779B9U;
+constexpr std::uint32_t cKEY_INCREMENT_1 = 0xBB67AE85U;
+constexpr unsigned int  cROUNDS          = 10U;
+constexpr std::uint64_t cFNV_PRIME       = 0x100000001B3ULL;
+
+std::uint32_t Low(std::uint64_t aValue)
+{
+   return static_cast<std::uint32_t>(aValue);
+}
+
+std::uint32_t High(std::uint64_t aValue)
+{
+   return static_cast<std::uint32_t>(aValue >> 32U);
+}
+} // namespace
+
+namespace wsf
+{
+namespace cyber
+{
+namespace random
+{
+constexpr std::uint64_t CounterRandom::cFNV_OFFSET_BASIS;
+
+// =================================================================================================
+CounterRandom::Result CounterRandom::Generate(const Counter& aCounter, const Key& aKey)
+{
+   Result value = aCounter;
+   Key    key   = aKey;
+   for (unsigned int round = 0U; round < cROUNDS; ++round)
+   {
+      if (round != 0U)
+      {
+         key[0] += cKEY_INCREMENT_0;
+         key[1] += cKEY_INCREMENT_1;
+      }
+
+      auto product0 = static_cast<std::uint64_t>(cMULTIPLIER_0) * value[0];
+      auto product1 = static_cast<std::uint64_t>(cMULTIPLIER_1) * value[2];
+      value         = {High(product1) ^ value[1] ^ key[0],
+                       Low(product1),
+                       High(product0) ^ value[3] ^ key[1],
+                       Low(product0)};
+   }
+
+   return value;
+}
+
+// =================================================================================================
+double CounterRandom::Uniform(const Counter& aCounter, const Key& aKey)
+{
+   //! The upper 53 bits of the first 64 bits of output, scaled to [0, 1).
+   auto value = Generate(aCounter, aKey);
+   auto bits  = (static_cast<std::uint64_t>(value[0]) << 32U) | value[1];
+   return static_cast<double>(bits >> 11U) * (1.0 / 9007199254740992.0);
+}
+
+// =================================================================================================
+double CounterRandom::Uniform(std::uint64_t aSeed, std::uint64_t aStream, std::uint64_t aPosition)
+{
+   return Uniform(Counter{Low(aPosition), High(aPosition), Low(aStream), High(aStream)}, Key{Low(aSeed), High(aSeed)});
+}
+
+// =================================================================================================
+std::uint64_t CounterRandom::Hash(const std::string& aText, std::uint64_t aHash) // = cFNV_OFFSET_BASIS
+{
+   for (auto character : aText)
+   {
+      aHash ^= static_cast<unsigned char>(character);
+      aHash *= cFNV_PRIME;
+   }
+
+   //! A byte that never occurs in UTF-8 text.
+   aHash ^= 0xFFU;
+   aHash *= cFNV_PRIME;
+   return aHash;
+}
+
+} // namespace random
+} // namespace cyber
+} // namespace wsf
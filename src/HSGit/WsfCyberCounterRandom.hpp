@@ -0,0 +1,64 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERCOUNTERRANDOM_HPP
+#define WSFCYBERCOUNTERRANDOM_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace wsf
+{
+namespace cyber
+{
+namespace random
+{
+
+//! A counter based random number generator (Philox4x32-10, Salmon et al., "Parallel Random
+//! Numbers: As Easy as 1, 2, 3", 2011). Each output is a pure function of a key and a counter,
+//! such that any output may be computed independently of any other, in any order, and from any
+//! thread. Distinct streams are provided by distinct keys, and distinct values within a stream
+//! are provided by distinct counters.
+class WSF_CYBER_EXPORT CounterRandom
+{
+public:
+   using Key     = std::array<std::uint32_t, 2>;
+   using Counter = std::array<std::uint32_t, 4>;
+   using Result  = std::array<std::uint32_t, 4>;
+
+   //! Returns the 128 bit random value for the counter and key.
+   static Result Generate(const Counter& aCounter, const Key& aKey);
+
+   //! Returns a uniformly distributed value in [0, 1) for the counter and key.
+   static double Uniform(const Counter& aCounter, const Key& aKey);
+
+   //! Returns a uniformly distributed value in [0, 1) for a 64 bit seed, a 64 bit stream
+   //! identifier and a 64 bit position within that stream.
+   static double Uniform(std::uint64_t aSeed, std::uint64_t aStream, std::uint64_t aPosition);
+
+   //! Returns a 64 bit FNV-1a hash of the text followed by a terminating byte, suitable for
+   //! deriving a stream identifier from names that are consistent across simulations. Hashes
+   //! may be chained by providing the previous hash, where the terminator ensures that distinct
+   //! sequences of text provide distinct input.
+   static std::uint64_t Hash(const std::string& aText, std::uint64_t aHash = cFNV_OFFSET_BASIS);
+
+   static constexpr std::uint64_t cFNV_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+};
+
+} // namespace random
+} // namespace cyber
+} // namespace wsf
+
+#endif
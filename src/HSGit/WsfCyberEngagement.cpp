@@ -12,16 +12,19 @@
 
 #include "WsfCyberEngagement.hpp"
 
+#include "UtLog.hpp"
 #include "UtMemory.hpp"
 #include "WsfCyberAttack.hpp"
-#include "WsfCyberAttackTypes.hpp"
+#include "WsfCyberAttackTypeInfo.hpp"
 #include "WsfCyberConstraint.hpp"
+#include "WsfCyberCounterRandom.hpp"
 #include "WsfCyberEngagement.hpp"
+#include "WsfCyberEngagementManager.hpp"
 #include "WsfCyberProtect.hpp"
 #include "WsfCyberProtectTypes.hpp"
-#include "WsfCyberScenarioExtension.hpp"
 #include "WsfCyberSimulationExtension.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfScriptContext.hpp"
 #include "WsfSimulation.hpp"
 
 // To avoid linux release error, we must include this macro to indicate a variable is used for assertion
@@ -32,31 +35,111 @@ namespace wsf
 namespace cyber
 {
 // =================================================================================================
-Engagement::Engagement(std::string    aAttackingPlatform,
-                       std::string    aVictimPlatform,
-                       std::string    aNamedAttack,
-                       WsfSimulation& aSimulation,
-                       size_t         aKey)
+Engagement::Engagement(std::string           aAttackingPlatform,
+                       std::string           aVictimPlatform,
+                       const AttackTypeInfo& aAttackTypeInfo,
+                       WsfSimulation&        aSimulation,
+                       size_t                aKey,
+                       size_t                aAttackerId,
+                       size_t                aVictimId)
    : mAttacker(std::move(aAttackingPlatform))
+   , mAttackerId(aAttackerId)
    , mVictim(std::move(aVictimPlatform))
-   , mNamedAttack(std::move(aNamedAttack))
+   , mVictimId(aVictimId)
+   , mNamedAttack(aAttackTypeInfo.GetName())
+   , mAttackTypeId(aAttackTypeInfo.GetId())
+   , mNamedAttackId(aAttackTypeInfo.GetNameId())
    , mKey{aKey}
+   , mAttackTypeInfoPtr(&aAttackTypeInfo)
    , mSimulation(aSimulation)
+{
+   Initialize();
+}
+
+// =================================================================================================
+const Attack* Engagement::GetAttack() const
+{
+   if (mAttackPtr)
+   {
+      return mAttackPtr;
+   }
+   return mAttackPrototypePtr.get();
+}
+
+// =================================================================================================
+const std::vector<std::string>& Engagement::GetAttackEffects() const
+{
+   return mAttackTypeInfoPtr->GetEffects();
+}
+
+// =================================================================================================
+Attack* Engagement::GetMutableAttack()
+{
+   if (!mAttackPtr && mAttackPrototypePtr)
+   {
+      mAttackPtr = ut::clone(mAttackPrototypePtr.get());
+   }
+   return mAttackPtr;
+}
+
+// =================================================================================================
+void Engagement::Initialize()
 {
    SetDefiningCyberObject();
    SetInitialValues();
 
-   auto attackerPtr = mSimulation.GetPlatformByName(mAttacker);
-   if (attackerPtr)
+   //! Both platforms were resolved during SetDefiningCyberObject().
+   mAttackerIndex = mAttackerCache.mIndex;
+   mVictimIndex   = mVictimCache.mIndex;
+
+   using random::CounterRandom;
+   mDrawStream = CounterRandom::Hash(mVictim, CounterRandom::Hash(mAttacker, CounterRandom::Hash(mNamedAttack)));
+}
+
+// =================================================================================================
+void Engagement::Retarget(std::string           aAttackingPlatform,
+                          std::string           aVictimPlatform,
+                          const AttackTypeInfo& aAttackTypeInfo,
+                          size_t                aKey,
+                          size_t                aAttackerId,
+                          size_t                aVictimId)
+{
+   if (mAttacker != aAttackingPlatform)
    {
-      mAttackerIndex = attackerPtr->GetIndex();
+      mAttacker      = std::move(aAttackingPlatform);
+      mAttackerCache = PlatformCache<Constraint>();
    }
-
-   auto victimPtr = mSimulation.GetPlatformByName(mVictim);
-   if (victimPtr)
+   if (mVictim != aVictimPlatform)
+   {
+      mVictim      = std::move(aVictimPlatform);
+      mVictimCache = PlatformCache<Protect>();
+   }
+   if (mAttackTypeInfoPtr != &aAttackTypeInfo)
    {
-      mVictimIndex = victimPtr->GetIndex();
+      mAttackTypeInfoPtr  = &aAttackTypeInfo;
+      mNamedAttack        = aAttackTypeInfo.GetName();
+      mAttackTypeId       = aAttackTypeInfo.GetId();
+      mNamedAttackId      = aAttackTypeInfo.GetNameId();
+      mAttackPrototypePtr = nullptr;
    }
+   mAttackPtr  = nullptr;
+   mAttackerId = aAttackerId;
+   mVictimId   = aVictimId;
+   mKey        = aKey;
+
+   //! Restore the values not otherwise established by Reset() or Initialize().
+   Reset(false);
+   Reset(true);
+   mCyberResourceUsage         = 0.0;
+   mAttackInProgress           = false;
+   mAttackAttributionThreshold = 0.0;
+   mScanAttributionThreshold   = 0.0;
+   mUseProtectDefinition       = false;
+   mProtectTypePtr             = nullptr;
+   mAttackAttempts             = 0U;
+   mScanAttempts               = 0U;
+
+   Initialize();
 }
 
 bool Engagement::GetStatusReportSuccess() const
@@ -75,44 +158,75 @@ Engagement::~Engagement()
 }
 
 // =================================================================================================
-void Engagement::SetDefiningCyberObject()
+template<class COMPONENT>
+const Engagement::PlatformCache<COMPONENT>& Engagement::Resolve(PlatformCache<COMPONENT>& aCache,
+                                                                const std::string&        aName) const
+{
+   if (!aCache.mPlatformPtr || (mSimulation.GetPlatformByIndex(aCache.mIndex) != aCache.mPlatformPtr))
+   {
+      aCache              = PlatformCache<COMPONENT>();
+      aCache.mPlatformPtr = mSimulation.GetPlatformByName(aName);
+      if (aCache.mPlatformPtr)
+      {
+         aCache.mComponentPtr = aCache.mPlatformPtr->template GetComponent<COMPONENT>();
+         aCache.mIndex        = aCache.mPlatformPtr->GetIndex();
+      }
+   }
+
+   return aCache;
+}
+
+// =================================================================================================
+WsfPlatform* Engagement::GetAttackerPlatform() const
+{
+   return Resolve(mAttackerCache, mAttacker).mPlatformPtr;
+}
+
+// =================================================================================================
+WsfPlatform* Engagement::GetVictimPlatform() const
+{
+   return Resolve(mVictimCache, mVictim).mPlatformPtr;
+}
+
+// =================================================================================================
+Constraint* Engagement::GetAttackerConstraint() const
+{
+   return Resolve(mAttackerCache, mAttacker).mComponentPtr;
+}
+
+// =================================================================================================
+Protect* Engagement::GetVictimProtect() const
 {
-   const auto& cyberScenario = ScenarioExtension::Get(mSimulation.GetScenario());
+   return Resolve(mVictimCache, mVictim).mComponentPtr;
+}
 
+// =================================================================================================
+void Engagement::SetDefiningCyberObject()
+{
    //! Get the corresponding WsfCyberProtect object for this engagement
    //! (at the current time. may become a pointer to a parent class type)
-   WsfPlatform* victimPtr   = mSimulation.GetPlatformByName(mVictim);
-   WsfPlatform* attackerPtr = mSimulation.GetPlatformByName(mAttacker);
-
-   if (!victimPtr)
+   if (!GetVictimPlatform())
    {
       throw UtException("WsfCyberEngagement could not find a valid target platform.");
    }
 
-   mProtectTypePtr = victimPtr->GetComponent<Protect>();
+   mProtectTypePtr = GetVictimProtect();
 
    if (!mProtectTypePtr)
    {
       throw UtException("WsfCyberEngagement could not find a valid target platform WsfCyberProtect object.");
    }
 
-   mConstraintPtr = attackerPtr->GetComponent<Constraint>();
-
-   if (!mConstraintPtr)
+   if (!GetAttackerConstraint())
    {
       throw UtException("WsfCyberEngagement could not find a valid constraint platform WsfCyberConstraint object.");
    }
 
-   //! Get the corresponding WsfCyberAttack object for this engagement
-   auto attackPtr = cyberScenario.GetAttackTypes().Find(mNamedAttack);
-
-   if (attackPtr)
+   //! Get the corresponding WsfCyberAttack object for this engagement, unless
+   //! retained from previous use of this engagement with the same attack type.
+   if (!mAttackPrototypePtr)
    {
-      mAttackPtr = ut::clone(attackPtr);
-   }
-   else
-   {
-      throw UtException("WsfCyberEngagement could not find a valid WsfCyberAttack.");
+      mAttackPrototypePtr = mAttackTypeInfoPtr->GetPrototype();
    }
 
    //! The agreed upon algorithm for determining precedence for which object defines the engagement
@@ -131,17 +245,16 @@ void Engagement::SetDefiningCyberObject()
       return;
    }
 
-   //! Check for case 2, return if found
-   auto parentTypes = mProtectTypePtr->GetTypeList();
-   for (const auto& parentType : parentTypes)
+   //! Check for case 2, return if found. The result of this search is shared
+   //! by all victims with the same protect type.
+   auto* curBase = EngagementManager::Get(mSimulation).FindInheritedProtection(*mProtectTypePtr,
+                                                                                 *mAttackTypeInfoPtr,
+                                                                                 mSimulation);
+   if (curBase)
    {
-      auto* curBase = cyberScenario.GetProtectTypes().Find(parentType);
-      if (curBase && curBase->ProtectionExists(mNamedAttack))
-      {
-         mProtectTypePtr       = curBase;
-         mUseProtectDefinition = true;
-         return;
-      }
+      mProtectTypePtr       = curBase;
+      mUseProtectDefinition = true;
+      return;
    }
 
    //! Check for case 3, return if found
@@ -161,32 +274,42 @@ void Engagement::SetInitialValues()
       throw UtException("Protect object must be a valid reference for WsfCyberEnagement value initialization.");
    }
 
-   if (mUseProtectDefinition)
+   if (mUseProtectDefinition && (mProtectTypePtr == GetVictimProtect()))
    {
-      mStatusReportThreshold    = mProtectTypePtr->GetProbabilityOfStatusReport(mNamedAttack);
-      mAttackDetectionThreshold = mProtectTypePtr->GetProbabilityOfAttackDetection(mNamedAttack);
-      mScanDetectionThreshold   = mProtectTypePtr->GetProbabilityOfScanDetection(mNamedAttack);
-      mAttackSuccessThreshold   = mProtectTypePtr->GetProbabilityOfAttackSuccess(mNamedAttack);
-      mImmunityThreshold        = mProtectTypePtr->GetProbabilityOfFutureImmunity(mNamedAttack);
+      //! Defined by the victim's own protect object, which is not shared.
+      //! Attribution is only defined by the attack type.
+      const auto& attack          = mAttackTypeInfoPtr->GetAttack();
+      mThresholdRow               = ThresholdTable::cNO_ROW;
+      mStatusReportThreshold      = mProtectTypePtr->GetProbabilityOfStatusReport(mNamedAttack);
+      mAttackDetectionThreshold   = mProtectTypePtr->GetProbabilityOfAttackDetection(mNamedAttack);
+      mAttackAttributionThreshold = attack.GetProbabilityOfAttackAttribution();
+      mScanDetectionThreshold     = mProtectTypePtr->GetProbabilityOfScanDetection(mNamedAttack);
+      mScanAttributionThreshold   = attack.GetProbabilityOfScanAttribution();
+      mAttackSuccessThreshold     = mProtectTypePtr->GetProbabilityOfAttackSuccess(mNamedAttack);
+      mImmunityThreshold          = mProtectTypePtr->GetProbabilityOfFutureImmunity(mNamedAttack);
    }
    else
    {
-      mStatusReportThreshold      = mAttackPtr->GetProbabilityOfStatusReport();
-      mAttackDetectionThreshold   = mAttackPtr->GetProbabilityOfAttackDetection();
-      mAttackAttributionThreshold = mAttackPtr->GetProbabilityOfAttackAttribution();
-      mScanDetectionThreshold     = mAttackPtr->GetProbabilityOfScanDetection();
-      mScanAttributionThreshold   = mAttackPtr->GetProbabilityOfScanAttribution();
-      mAttackSuccessThreshold     = mAttackPtr->GetProbabilityOfAttackSuccess();
-      mImmunityThreshold          = mAttackPtr->GetProbabilityOfFutureImmunity();
+      //! Defined by an inherited protect type or the attack type, shared by all such engagements.
+      auto&       manager         = EngagementManager::Get(mSimulation);
+      const auto& thresholds      = manager.GetThresholdTable();
+      mThresholdRow               = manager.GetThresholdRow(mUseProtectDefinition ? mProtectTypePtr : nullptr,
+                                                      *mAttackTypeInfoPtr);
+      mStatusReportThreshold      = thresholds.Get(mThresholdRow, ThresholdTable::cSTATUS_REPORT);
+      mAttackDetectionThreshold   = thresholds.Get(mThresholdRow, ThresholdTable::cATTACK_DETECTION);
+      mAttackAttributionThreshold = thresholds.Get(mThresholdRow, ThresholdTable::cATTACK_ATTRIBUTION);
+      mScanDetectionThreshold     = thresholds.Get(mThresholdRow, ThresholdTable::cSCAN_DETECTION);
+      mScanAttributionThreshold   = thresholds.Get(mThresholdRow, ThresholdTable::cSCAN_ATTRIBUTION);
+      mAttackSuccessThreshold     = thresholds.Get(mThresholdRow, ThresholdTable::cATTACK_SUCCESS);
+      mImmunityThreshold          = thresholds.Get(mThresholdRow, ThresholdTable::cIMMUNITY);
    }
 
-   mTimeScanDelay            = mAttackPtr->GetTimeDelayScan();
-   mTimeDeliveryDelay        = mAttackPtr->GetTimeDelayDelivery();
-   mAttackEffectTypes        = mAttackPtr->GetEffects();
+   mTimeScanDelay            = mAttackTypeInfoPtr->GetTimeDelayScan();
+   mTimeDeliveryDelay        = mAttackTypeInfoPtr->GetTimeDelayDelivery();
    mTimeAttackDetectionDelay = mProtectTypePtr->DetectionDelayTime(mNamedAttack);
    mTimeAttackRecoveryDelay  = mProtectTypePtr->RecoveryDelayTime(mNamedAttack);
    mRecover                  = mProtectTypePtr->DoRestore(mNamedAttack);
-   mDuration                 = mAttackPtr->GetDuration();
+   mDuration                 = mAttackTypeInfoPtr->GetDuration();
 }
 
 // =================================================================================================
@@ -204,12 +327,14 @@ bool Engagement::IsVictimImmune() const
 void Engagement::SetAttackStartTime()
 {
    mTimeAttackStart = mSimulation.GetSimTime();
+   ++mAttackAttempts;
 }
 
 // =================================================================================================
 void Engagement::SetScanStartTime()
 {
    mTimeScanStart = mSimulation.GetSimTime();
+   ++mScanAttempts;
 }
 
 // =================================================================================================
@@ -227,11 +352,9 @@ void Engagement::SetTimeAttackRecovery()
 // =================================================================================================
 bool Engagement::Draw(random::ProbabilityType aProbabilityType)
 {
-   auto& drawManager = SimulationExtension::Get(mSimulation).GetCyberDrawManager();
-
    if (aProbabilityType == random::cSCAN_DETECTION)
    {
-      mScanDetectionDraw = drawManager.Draw(mNamedAttack, mVictim, aProbabilityType);
+      mScanDetectionDraw = GetDrawValue(aProbabilityType);
       if (mScanDetectionDraw <= mScanDetectionThreshold)
       {
          return true;
@@ -240,7 +363,7 @@ bool Engagement::Draw(random::ProbabilityType aProbabilityType)
    }
    else if (aProbabilityType == random::cSCAN_ATTRIBUTION)
    {
-      mScanAttributionDraw = drawManager.Draw(mNamedAttack, mVictim, aProbabilityType);
+      mScanAttributionDraw = GetDrawValue(aProbabilityType);
       if (mScanAttributionDraw <= mScanAttributionThreshold)
       {
          return true;
@@ -249,7 +372,7 @@ bool Engagement::Draw(random::ProbabilityType aProbabilityType)
    }
    else if (aProbabilityType == random::cATTACK_SUCCESS)
    {
-      mAttackDraw = drawManager.Draw(mNamedAttack, mVictim, aProbabilityType);
+      mAttackDraw = GetDrawValue(aProbabilityType);
       if (mAttackDraw <= mAttackSuccessThreshold)
       {
          return true;
@@ -258,7 +381,7 @@ bool Engagement::Draw(random::ProbabilityType aProbabilityType)
    }
    else if (aProbabilityType == random::cSTATUS_REPORT)
    {
-      mStatusReportDraw = drawManager.Draw(mNamedAttack, mVictim, aProbabilityType);
+      mStatusReportDraw = GetDrawValue(aProbabilityType);
       if (mStatusReportDraw <= mStatusReportThreshold)
       {
          return true;
@@ -267,7 +390,7 @@ bool Engagement::Draw(random::ProbabilityType aProbabilityType)
    }
    else if (aProbabilityType == random::cATTACK_DETECTION)
    {
-      mAttackDetectionDraw = drawManager.Draw(mNamedAttack, mVictim, aProbabilityType);
+      mAttackDetectionDraw = GetDrawValue(aProbabilityType);
       if (mAttackDetectionDraw <= mAttackDetectionThreshold)
       {
          return true;
@@ -276,8 +399,8 @@ bool Engagement::Draw(random::ProbabilityType aProbabilityType)
    }
    else if (aProbabilityType == random::cATTACK_ATTRIBUTION)
    {
-      mAttackAttributionDraw = drawManager.Draw(mNamedAttack, mVictim, aProbabilityType);
-      if (mAttackAttributionDraw <= mAttackAttributionDraw)
+      mAttackAttributionDraw = GetDrawValue(aProbabilityType);
+      if (mAttackAttributionDraw <= mAttackAttributionThreshold)
       {
          return true;
       }
@@ -285,7 +408,7 @@ bool Engagement::Draw(random::ProbabilityType aProbabilityType)
    }
    else if (aProbabilityType == random::cFUTURE_IMMUNITY)
    {
-      mImmunityDraw = drawManager.Draw(mNamedAttack, mVictim, aProbabilityType);
+      mImmunityDraw = GetDrawValue(aProbabilityType);
       if (mImmunityDraw <= mImmunityThreshold)
       {
          //! This is a special case. The victim/target has become immune to this attack.
@@ -294,13 +417,13 @@ bool Engagement::Draw(random::ProbabilityType aProbabilityType)
          //! against this target using the same attack) register the immunity when queried.
          //! NOTE: We cannot naively use the mProtectTypePtr to register the immunity. This may
          //! point to a "parent" cyber_protection, and not the component on the target itself
-         auto victimPtr = mSimulation.GetPlatformByName(mVictim);
-         if (!victimPtr)
+         auto victimProtectPtr = GetVictimProtect();
+         if (!victimProtectPtr)
          {
             return false;
          }
 
-         victimPtr->GetComponent<Protect>()->SetImmune(mNamedAttack);
+         victimProtectPtr->SetImmune(mNamedAttack);
          return true;
       }
       return false;
@@ -310,6 +433,22 @@ bool Engagement::Draw(random::ProbabilityType aProbabilityType)
    throw UtException("Unexpected conditional branch in WsfCyberEngagment::Draw.");
 }
 
+// =================================================================================================
+double Engagement::GetDrawValue(random::ProbabilityType aProbabilityType) const
+{
+   auto& manager = EngagementManager::Get(mSimulation);
+   if (!manager.IsCounterBasedDraws())
+   {
+      return SimulationExtension::Get(mSimulation).GetCyberDrawManager().Draw(mNamedAttack, mVictim, aProbabilityType);
+   }
+
+   //! Each attempt provides a distinct position within the engagement stream for each probability type.
+   bool isScan   = ((aProbabilityType == random::cSCAN_DETECTION) || (aProbabilityType == random::cSCAN_ATTRIBUTION));
+   auto attempts = isScan ? mScanAttempts : mAttackAttempts;
+   auto position = (static_cast<std::uint64_t>(attempts) << 32U) | static_cast<std::uint32_t>(aProbabilityType);
+   return random::CounterRandom::Uniform(manager.GetDrawSeed(), mDrawStream, position);
+}
+
 // =================================================================================================
 void Engagement::Reset(bool aScanReset) // bool aScanReset = false
 {
@@ -339,24 +478,18 @@ void Engagement::Reset(bool aScanReset) // bool aScanReset = false
 // =================================================================================================
 void Engagement::ReleaseAttackerConstraints()
 {
-   auto platform = mSimulation.GetPlatformByName(mAttacker);
-
    // If the platform is destroyed there is no need to restore its resources.
-   if (platform)
+   auto platformCyberConstraint = GetAttackerConstraint();
+   if (platformCyberConstraint)
    {
-      auto platformCyberConstraint = Constraint::Find(*platform);
+      // Give the attacking platform back its cyber resources.
+      bool valid = platformCyberConstraint->RestoreResources(mCyberResourceUsage);
+      assert(valid);
+      _unused(valid); // indicate that valid is unused in Release
 
-      if (platformCyberConstraint)
-      {
-         // Give the attacking platform back its cyber resources.
-         bool valid = platformCyberConstraint->RestoreResources(mCyberResourceUsage);
-         assert(valid);
-         _unused(valid); // indicate that valid is unused in Release
+      mCyberResourceUsage = 0.0;
 
-         mCyberResourceUsage = 0.0;
-
-         platformCyberConstraint->RemoveConcurrentAttack(mNamedAttack, mKey);
-      }
+      platformCyberConstraint->RemoveConcurrentAttack(mNamedAttackId, mKey);
    }
 }
 
@@ -364,25 +497,27 @@ void Engagement::ReleaseAttackerConstraints()
 bool Engagement::MeetsAttackerConstraints()
 {
    // Get platform resources
-   auto   platformCyberConstraint = Constraint::Find(*(GetSimulation().GetPlatformByName(mAttacker)));
-   double attackerResources       = platformCyberConstraint->GetCurrentResources();
-
-   auto cyberScenario = ScenarioExtension::Get(SimulationExtension::Get(GetSimulation()).GetScenario());
-   auto attackType    = cyberScenario.GetAttackTypes().Find(mNamedAttack);
+   auto platformCyberConstraint = GetAttackerConstraint();
+   if (!platformCyberConstraint)
+   {
+      return false;
+   }
+   double attackerResources = platformCyberConstraint->GetCurrentResources();
 
-   return (attackerResources >= attackType->GetResourceRequirements());
+   return (attackerResources >= mAttackTypeInfoPtr->GetResourceRequirements());
 }
 
 // =================================================================================================
 bool Engagement::MakeConstraintReservations()
 {
    // Get platform resources
-   auto   platformCyberConstraint = Constraint::Find(*(GetSimulation().GetPlatformByName(mAttacker)));
-   double attackerResources       = platformCyberConstraint->GetCurrentResources();
-
-   auto cyberScenario    = ScenarioExtension::Get(SimulationExtension::Get(GetSimulation()).GetScenario());
-   auto attackType       = cyberScenario.GetAttackTypes().Find(mNamedAttack);
-   auto resourceRequired = attackType->GetResourceRequirements();
+   auto platformCyberConstraint = GetAttackerConstraint();
+   if (!platformCyberConstraint)
+   {
+      return false;
+   }
+   double attackerResources = platformCyberConstraint->GetCurrentResources();
+   auto   resourceRequired  = mAttackTypeInfoPtr->GetResourceRequirements();
 
    bool isSufficientResources = attackerResources >= resourceRequired;
 
@@ -391,7 +526,7 @@ bool Engagement::MakeConstraintReservations()
       platformCyberConstraint->RemoveResources(resourceRequired);
       mCyberResourceUsage = resourceRequired;
 
-      platformCyberConstraint->AddConcurrentAttack(mNamedAttack, mKey);
+      platformCyberConstraint->AddConcurrentAttack(mNamedAttackId, mKey);
    }
 
    return isSufficientResources;
@@ -444,6 +579,21 @@ ScriptEngagement::ScriptEngagement(const std::string& aClassName, UtScriptTypes*
    AddMethod(ut::make_unique<ScanSuccess>());
    AddMethod(ut::make_unique<ScanInProgress>());
    AddMethod(ut::make_unique<ScanFailureReason>());
+
+   //! History script methods
+   AddMethod(ut::make_unique<HistorySize>());
+   AddMethod(ut::make_unique<HistoryTimeAttackInitiated>());
+   AddMethod(ut::make_unique<HistoryTimeAttackCompleted>());
+   AddMethod(ut::make_unique<HistoryAttackSuccess>());
+   AddMethod(ut::make_unique<HistoryAttackSuccessDraw>());
+   AddMethod(ut::make_unique<HistoryAttackFailureReason>());
+   AddMethod(ut::make_unique<HistoryAttackDetected>());
+   AddMethod(ut::make_unique<HistoryAttackAttributed>());
+   AddMethod(ut::make_unique<HistoryRecovery>());
+
+   //! Batch script methods
+   AddStaticMethod(ut::make_unique<CyberAttackBatch>());
+   AddStaticMethod(ut::make_unique<CyberScanBatch>());
 }
 
 // =================================================================================================
@@ -455,7 +605,7 @@ UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, Attacker, 0, "string", "")
 // =================================================================================================
 UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, AttackerPlatform, 0, "WsfPlatform", "")
 {
-   auto platformPtr = WsfScriptContext::GetSIMULATION(aContext)->GetPlatformByName(aObjectPtr->GetAttacker());
+   auto platformPtr = aObjectPtr->GetAttackerPlatform();
    aReturnVal.SetPointer(UtScriptRef::Ref(platformPtr, aReturnClassPtr));
 }
 
@@ -474,7 +624,7 @@ UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, Victim, 0, "string", "")
 // =================================================================================================
 UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, VictimPlatform, 0, "WsfPlatform", "")
 {
-   auto platformPtr = aObjectPtr->GetSimulation().GetPlatformByName(aObjectPtr->GetVictim());
+   auto platformPtr = aObjectPtr->GetVictimPlatform();
    aReturnVal.SetPointer(UtScriptRef::Ref(platformPtr, aReturnClassPtr));
 }
 
@@ -672,5 +822,165 @@ UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, AttackFailureReason, 0, "i
    aReturnVal.SetInt(reason);
 }
 
+namespace
+{
+//! Provides the history record for the engagement at the index provided by the script.
+//! Returns false if no such record exists.
+bool GetHistoryRecord(const Engagement& aEngagement, int aIndex, EngagementHistory::Record& aRecord)
+{
+   if (aIndex < 0)
+   {
+      return false;
+   }
+
+   const auto& history = EngagementManager::Get(aEngagement.GetSimulation()).GetHistory();
+   return history.GetRecord(aEngagement.GetKey(), static_cast<size_t>(aIndex), aRecord);
+}
+
+//! Converts the script arguments of a batch method to batch requests. Returns false,
+//! providing no requests, if the argument arrays are not of equal length.
+bool GetBatchRequests(const UtScriptMethodArgs& aVarArgs, std::vector<EngagementManager::BatchRequest>& aRequests)
+{
+   const auto& attackTypes = *aVarArgs[0].GetPointer()->GetAppObject<std::vector<UtScriptData>>();
+   const auto& attackers   = *aVarArgs[1].GetPointer()->GetAppObject<std::vector<UtScriptData>>();
+   const auto& victims     = *aVarArgs[2].GetPointer()->GetAppObject<std::vector<UtScriptData>>();
+   if ((attackTypes.size() != attackers.size()) || (attackTypes.size() != victims.size()))
+   {
+      auto out = ut::log::error() << "Cyber batch request arrays must be of equal length.";
+      out.AddNote() << "Attack Types: " << attackTypes.size();
+      out.AddNote() << "Attackers: " << attackers.size();
+      out.AddNote() << "Victims: " << victims.size();
+      return false;
+   }
+
+   aRequests.resize(attackTypes.size());
+   for (size_t i = 0U; i < aRequests.size(); ++i)
+   {
+      aRequests[i].mAttackType = attackTypes[i].GetString();
+      aRequests[i].mAttacker   = attackers[i].GetString();
+      aRequests[i].mVictim     = victims[i].GetString();
+   }
+   return true;
+}
+
+void SetBatchResults(const std::vector<bool>& aResults, UtScriptData& aReturnVal, UtScriptClass* aReturnClassPtr)
+{
+   auto resultVecPtr = ut::make_unique<std::vector<UtScriptData>>();
+   resultVecPtr->reserve(aResults.size());
+   for (auto result : aResults)
+   {
+      resultVecPtr->emplace_back(static_cast<bool>(result));
+   }
+   aReturnVal.SetPointer(new UtScriptRef(resultVecPtr.release(), aReturnClassPtr, UtScriptRef::cMANAGE));
+}
+} // namespace
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistorySize, 0, "int", "")
+{
+   const auto& history = EngagementManager::Get(aObjectPtr->GetSimulation()).GetHistory();
+   aReturnVal.SetInt(ut::cast_to_int(history.GetCount(aObjectPtr->GetKey())));
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistoryTimeAttackInitiated, 1, "double", "int")
+{
+   EngagementHistory::Record record;
+   bool                      found = GetHistoryRecord(*aObjectPtr, aVarArgs[0].GetInt(), record);
+   aReturnVal.SetDouble(found ? record.mTimeAttackStart : -1.0);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistoryTimeAttackCompleted, 1, "double", "int")
+{
+   EngagementHistory::Record record;
+   bool                      found = GetHistoryRecord(*aObjectPtr, aVarArgs[0].GetInt(), record);
+   aReturnVal.SetDouble(found ? record.mTimeAttackEnd : -1.0);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistoryAttackSuccess, 1, "bool", "int")
+{
+   EngagementHistory::Record record;
+   bool                      found = GetHistoryRecord(*aObjectPtr, aVarArgs[0].GetInt(), record);
+   aReturnVal.SetBool(found && record.mAttackSuccess);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistoryAttackSuccessDraw, 1, "double", "int")
+{
+   EngagementHistory::Record record;
+   bool                      found = GetHistoryRecord(*aObjectPtr, aVarArgs[0].GetInt(), record);
+   aReturnVal.SetDouble(found ? static_cast<double>(record.mAttackDraw) : -1.0);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistoryAttackFailureReason, 1, "int", "int")
+{
+   EngagementHistory::Record record;
+   bool                      found = GetHistoryRecord(*aObjectPtr, aVarArgs[0].GetInt(), record);
+   aReturnVal.SetInt(found ? record.mFailureReason : Engagement::cATTACK_NONE);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistoryAttackDetected, 1, "bool", "int")
+{
+   EngagementHistory::Record record;
+   bool                      found = GetHistoryRecord(*aObjectPtr, aVarArgs[0].GetInt(), record);
+   aReturnVal.SetBool(found && record.mAttackDetected);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistoryAttackAttributed, 1, "bool", "int")
+{
+   EngagementHistory::Record record;
+   bool                      found = GetHistoryRecord(*aObjectPtr, aVarArgs[0].GetInt(), record);
+   aReturnVal.SetBool(found && record.mAttackAttributed);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement, Engagement, HistoryRecovery, 1, "bool", "int")
+{
+   EngagementHistory::Record record;
+   bool                      found = GetHistoryRecord(*aObjectPtr, aVarArgs[0].GetInt(), record);
+   aReturnVal.SetBool(found && record.mRecovered);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement,
+                        Engagement,
+                        CyberAttackBatch,
+                        3,
+                        "Array<bool>",
+                        "Array<string>, Array<string>, Array<string>")
+{
+   std::vector<EngagementManager::BatchRequest> requests;
+   std::vector<bool>                            results;
+   if (GetBatchRequests(aVarArgs, requests))
+   {
+      auto& sim = *WsfScriptContext::GetSIMULATION(aContext);
+      results   = EngagementManager::Get(sim).CyberAttackBatch(requests, sim);
+   }
+   SetBatchResults(results, aReturnVal, aReturnClassPtr);
+}
+
+// =================================================================================================
+UT_DEFINE_SCRIPT_METHOD(ScriptEngagement,
+                        Engagement,
+                        CyberScanBatch,
+                        3,
+                        "Array<bool>",
+                        "Array<string>, Array<string>, Array<string>")
+{
+   std::vector<EngagementManager::BatchRequest> requests;
+   std::vector<bool>                            results;
+   if (GetBatchRequests(aVarArgs, requests))
+   {
+      auto& sim = *WsfScriptContext::GetSIMULATION(aContext);
+      results   = EngagementManager::Get(sim).CyberScanBatch(requests, sim);
+   }
+   SetBatchResults(results, aReturnVal, aReturnClassPtr);
+}
+
 } // namespace cyber
 } // namespace wsf
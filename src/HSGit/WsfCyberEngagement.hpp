@@ -14,13 +14,17 @@
 
 #include "wsf_cyber_export.h"
 
+#include <cstdint>
 #include <limits>
+#include <memory>
 
 #include "UtCloneablePtr.hpp"
 #include "UtScriptAccessible.hpp"
 #include "UtScriptBasicTypes.hpp"
 #include "UtScriptClass.hpp"
 #include "WsfCyberRandom.hpp"
+#include "WsfCyberThresholdTable.hpp"
+#include "WsfStringId.hpp"
 class WsfPlatform;
 class WsfSimulation;
 
@@ -29,6 +33,7 @@ namespace wsf
 namespace cyber
 {
 class Attack;
+class AttackTypeInfo;
 class Protect;
 class Constraint;
 
@@ -54,11 +59,15 @@ public:
    };
 
    //! No default constructor usage - parameters required for instantiation.
-   Engagement(std::string    aAttackingPlatform,
-              std::string    aVictimPlatform,
-              std::string    aNamedAttack,
-              WsfSimulation& aSimulation,
-              size_t         aKey);
+   //! The attack type information and identifiers are those provided by the
+   //! engagement manager for the attack type and platform names.
+   Engagement(std::string           aAttackingPlatform,
+              std::string           aVictimPlatform,
+              const AttackTypeInfo& aAttackTypeInfo,
+              WsfSimulation&        aSimulation,
+              size_t                aKey,
+              size_t                aAttackerId,
+              size_t                aVictimId);
 
    virtual ~Engagement();
 
@@ -71,19 +80,36 @@ public:
    //! @name Public accessors for engagement data
    //@{
    const std::string& GetAttacker() const { return mAttacker; }
+   size_t             GetAttackerId() const { return mAttackerId; }
    size_t             GetAttackerIndex() const { return mAttackerIndex; }
    const std::string& GetVictim() const { return mVictim; }
+   size_t             GetVictimId() const { return mVictimId; }
    size_t             GetVictimIndex() const { return mVictimIndex; }
    const std::string& GetAttackType() const { return mNamedAttack; }
+   size_t             GetAttackTypeId() const { return mAttackTypeId; }
+   WsfStringId        GetAttackTypeStringId() const { return mNamedAttackId; }
    size_t             GetKey() const { return mKey; }
 
-   Attack* GetAttack() const { return mAttackPtr; }
-   double  GetDuration() const { return mDuration; }
-   double  GetAttackStartTime() const { return mTimeAttackStart; }
-   double  GetAttackSuccessThreshold() const { return mAttackSuccessThreshold; }
-   double  GetAttackDraw() const { return mAttackDraw; }
-   double  GetStatusReportThreshold() const { return mStatusReportThreshold; }
-   double  GetStatusReportDraw() const { return mStatusReportDraw; }
+   const AttackTypeInfo& GetAttackTypeInfo() const { return *mAttackTypeInfoPtr; }
+
+   //! Returns the row of the engagement manager threshold table providing the thresholds of
+   //! this engagement, or ThresholdTable::cNO_ROW if defined by the victim's protect object.
+   ThresholdTable::Row GetThresholdRow() const { return mThresholdRow; }
+
+   //! Returns the attack object for this engagement. Unless modified via GetMutableAttack(),
+   //! this is the attack prototype shared by all engagements using this attack type.
+   const Attack* GetAttack() const;
+
+   //! Returns an attack object owned by this engagement that may be modified, such as by
+   //! user extensions. The shared attack prototype is copied on the first call.
+   Attack* GetMutableAttack();
+
+   double GetDuration() const { return mDuration; }
+   double GetAttackStartTime() const { return mTimeAttackStart; }
+   double GetAttackSuccessThreshold() const { return mAttackSuccessThreshold; }
+   double GetAttackDraw() const { return mAttackDraw; }
+   double GetStatusReportThreshold() const { return mStatusReportThreshold; }
+   double GetStatusReportDraw() const { return mStatusReportDraw; }
 
    //! Returns true if the attack status has been reported.
    //! Returns false if it failed to be reported or hasn't yet been reported.
@@ -105,7 +131,7 @@ public:
    bool                            GetScanSuccess() const { return mScanSuccess; }
    bool                            GetAttackInProgress() const { return mAttackInProgress; }
    bool                            GetAttackSuccess() const { return mAttackSuccess; }
-   const std::vector<std::string>& GetAttackEffects() const { return mAttackEffectTypes; }
+   const std::vector<std::string>& GetAttackEffects() const;
    double                          GetAttackDetectionDelayTime() const { return mTimeAttackDetectionDelay; }
    double                          GetAttackRecoveryDelayTime() const { return mTimeAttackRecoveryDelay; }
    double                          GetImmunityThreshold() const { return mImmunityThreshold; }
@@ -116,6 +142,17 @@ public:
    Protect* GetUsedProtection() { return mProtectTypePtr; }
    //@}
 
+   //! @name Platform accessors
+   //! Provides the platforms currently using the attacker and victim names, along with their
+   //! cyber components, or nullptr if no such platform or component exists.
+   //! @note Resolution is cached, such that repeated calls do not search for the platform by name.
+   //@{
+   WsfPlatform* GetAttackerPlatform() const;
+   WsfPlatform* GetVictimPlatform() const;
+   Constraint*  GetAttackerConstraint() const;
+   Protect*     GetVictimProtect() const;
+   //@}
+
    //! @name Accessor methods for engagement failure status
    //@{
    CyberAttackFailure GetAttackFailureReason() const { return mAttackFailure; }
@@ -154,14 +191,33 @@ public:
    //! Asks the engagement object to generate a draw for the supplied probability type
    //! The values generated will be stored with the engagement object
    //! A boolean value is return to indicate if the threshold was met
+   //! @note When the engagement manager uses counter based draws, the value drawn depends only
+   //! on the draw seed, the engagement names, the attempt number and the probability type.
    bool Draw(random::ProbabilityType aProbabilityType);
 
+   //! Returns the number of attack and scan attempts started by this engagement.
+   std::uint32_t GetAttackAttempts() const { return mAttackAttempts; }
+   std::uint32_t GetScanAttempts() const { return mScanAttempts; }
+
    //! @name Reset Method
    //! Re-establishes original values on member variables in this object,
    //! with the exception of values that aid subsequent uses of the engagement
    //! object
    virtual void Reset(bool aScanReset = false);
 
+   //! @name Retarget Method
+   //! Re-establishes this engagement for a new attacker, victim and attack type, as if newly
+   //! constructed with these values. This allows for the reuse of an engagement object that is
+   //! no longer required, retaining resolved data that remains valid. Platform resolution is
+   //! retained for unchanged platform names. Any modified attack object is discarded.
+   //! @note Any resources reserved by this engagement must be released prior to this call.
+   void Retarget(std::string           aAttackingPlatform,
+                 std::string           aVictimPlatform,
+                 const AttackTypeInfo& aAttackTypeInfo,
+                 size_t                aKey,
+                 size_t                aAttackerId,
+                 size_t                aVictimId);
+
    //! @name Release Attack Constraints Method
    //! Releases all resources consumed by attacker after it has been destroyed.
    void ReleaseAttackerConstraints();
@@ -184,6 +240,39 @@ public:
    WsfSimulation& GetSimulation() const { return mSimulation; }
 
 private:
+   //! Resolves the objects defining this engagement, and sets the initial values accordingly.
+   void Initialize();
+
+   //! Provides the value for a draw of the probability type.
+   double GetDrawValue(random::ProbabilityType aProbabilityType) const;
+
+   //! A platform resolved by name, and a component of interest on that platform. The simulation
+   //! never reuses a platform index, so the cached index serves as a generation check: if the
+   //! platform has been deleted, it is no longer returned by its index, and the cache (including the
+   //! component) is dropped and resolved by name again, as another platform may now use the name.
+   //! Moving a cache empties the source, so that a moved-from engagement never acts on the platform.
+   template<class COMPONENT>
+   struct PlatformCache
+   {
+      PlatformCache() = default;
+      PlatformCache(PlatformCache&& aSrc)
+         : mPlatformPtr(aSrc.mPlatformPtr)
+         , mComponentPtr(aSrc.mComponentPtr)
+         , mIndex(aSrc.mIndex)
+      {
+         aSrc = PlatformCache();
+      }
+      PlatformCache& operator=(PlatformCache&& aRhs) = default;
+
+      WsfPlatform* mPlatformPtr{nullptr};
+      COMPONENT*   mComponentPtr{nullptr};
+      size_t       mIndex{0U};
+   };
+
+   //! Validates the cache, resolving the named platform and its component if required.
+   template<class COMPONENT>
+   const PlatformCache<COMPONENT>& Resolve(PlatformCache<COMPONENT>& aCache, const std::string& aName) const;
+
    //! @name SetDefiningCyberObject method
    //! This method is called during the construction of the engagement object and provides
    //! the values for the attack and protection object pointers, and sets the mUseProtectionDefinition
@@ -200,12 +289,25 @@ private:
    void SetInitialValues();
 
    std::string mAttacker{};
+   size_t      mAttackerId{0U};
    size_t      mAttackerIndex{0U};
    std::string mVictim{};
+   size_t      mVictimId{0U};
    size_t      mVictimIndex{0U};
    std::string mNamedAttack{};
+   size_t      mAttackTypeId{0U};
+   WsfStringId mNamedAttackId{};
    size_t      mKey{0U};
 
+   //! Identifies the random stream of this engagement when using counter based draws. This
+   //! is derived from the engagement names, and not the key, as the key is specific to a simulation.
+   std::uint64_t mDrawStream{0U};
+   std::uint32_t mAttackAttempts{0U};
+   std::uint32_t mScanAttempts{0U};
+
+   //! Shared attack type data, owned by the engagement manager.
+   const AttackTypeInfo* mAttackTypeInfoPtr;
+
    //! Attack member variables
    double             mTimeAttackStart{std::numeric_limits<double>::max()};
    double             mDuration{-1.0};
@@ -242,18 +344,20 @@ private:
    double mImmunityThreshold{0.0};
    double mImmunityDraw{-1.0};
 
-   bool mUseProtectDefinition{false};
+   bool                mUseProtectDefinition{false};
+   ThresholdTable::Row mThresholdRow{ThresholdTable::cNO_ROW};
+
+   WsfSimulation& mSimulation;
+   Protect*       mProtectTypePtr{nullptr};
 
-   WsfSimulation&           mSimulation;
-   Protect*                 mProtectTypePtr{nullptr};
-   Constraint*              mConstraintPtr{nullptr};
-   std::vector<std::string> mAttackEffectTypes{};
+   mutable PlatformCache<Constraint> mAttackerCache{};
+   mutable PlatformCache<Protect>    mVictimCache{};
 
-   //! A copy of the attack object. The attack object is
-   //! simply copied and maintained with an engagement object.
-   //! This reduces the need for copying data and provides
-   //! better support for user extensions.
-   UtCloneablePtr<Attack> mAttackPtr{nullptr};
+   //! The attack object, shared by all engagements of this attack type. A copy
+   //! owned by this engagement is only made if modification is required, after
+   //! which the copy is used in place of the shared attack.
+   std::shared_ptr<const Attack> mAttackPrototypePtr{nullptr};
+   UtCloneablePtr<Attack>        mAttackPtr{nullptr};
 };
 
 
@@ -307,6 +411,27 @@ public:
    UT_DECLARE_SCRIPT_METHOD(ScanInProgress);
    UT_DECLARE_SCRIPT_METHOD(ScanFailureReason);
    //@}
+
+   //! Accessor methods for the history of completed attacks for this engagement.
+   //! Indices are zero for the most recent attack, increasing with age.
+   //@{
+   UT_DECLARE_SCRIPT_METHOD(HistorySize);
+   UT_DECLARE_SCRIPT_METHOD(HistoryTimeAttackInitiated);
+   UT_DECLARE_SCRIPT_METHOD(HistoryTimeAttackCompleted);
+   UT_DECLARE_SCRIPT_METHOD(HistoryAttackSuccess);
+   UT_DECLARE_SCRIPT_METHOD(HistoryAttackSuccessDraw);
+   UT_DECLARE_SCRIPT_METHOD(HistoryAttackFailureReason);
+   UT_DECLARE_SCRIPT_METHOD(HistoryAttackDetected);
+   UT_DECLARE_SCRIPT_METHOD(HistoryAttackAttributed);
+   UT_DECLARE_SCRIPT_METHOD(HistoryRecovery);
+   //@}
+
+   //! Static batch methods, for initiating many attacks or scans in a single call.
+   //! Each argument is an array of equal length, with each index comprising a single request.
+   //@{
+   UT_DECLARE_SCRIPT_METHOD(CyberAttackBatch);
+   UT_DECLARE_SCRIPT_METHOD(CyberScanBatch);
+   //@}
 };
 
 } // namespace cyber
@@ -0,0 +1,230 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfCyberEngagementHistory.hpp"
+
+#include <algorithm>
+
+namespace
+{
+enum Flag : std::uint8_t
+{
+   cATTACK_SUCCESS    = 1U << 0U,
+   cSTATUS_REPORTED   = 1U << 1U,
+   cATTACK_DETECTED   = 1U << 2U,
+   cATTACK_ATTRIBUTED = 1U << 3U,
+   cIMMUNITY          = 1U << 4U,
+   cRECOVERED         = 1U << 5U
+};
+
+//! Returns true if the draw occurred and met the threshold.
+bool DrawSucceeded(double aDraw, double aThreshold)
+{
+   return ((aDraw >= 0.0) && (aDraw <= aThreshold));
+}
+} // namespace
+
+namespace wsf
+{
+namespace cyber
+{
+constexpr size_t                      EngagementHistory::cDEFAULT_CAPACITY;
+constexpr EngagementHistory::Sequence EngagementHistory::cNO_SEQUENCE;
+
+// =================================================================================================
+EngagementHistory::EngagementHistory(size_t aCapacity) // = cDEFAULT_CAPACITY
+{
+   SetCapacity(aCapacity);
+}
+
+// =================================================================================================
+void EngagementHistory::SetCapacity(size_t aCapacity)
+{
+   auto capacity = std::max(aCapacity, size_t{1U});
+   mSequences.assign(capacity, cNO_SEQUENCE);
+   mPrevious.assign(capacity, cNO_SEQUENCE);
+   mKeys.assign(capacity, 0U);
+   mTimeAttackStart.assign(capacity, 0.0);
+   mTimeAttackEnd.assign(capacity, 0.0);
+   mAttackDraw.assign(capacity, -1.0F);
+   mStatusReportDraw.assign(capacity, -1.0F);
+   mAttackDetectionDraw.assign(capacity, -1.0F);
+   mAttackAttributionDraw.assign(capacity, -1.0F);
+   mImmunityDraw.assign(capacity, -1.0F);
+   mFailureReason.assign(capacity, 0U);
+   mFlags.assign(capacity, 0U);
+   mLatest.Clear();
+   mLastSequence = cNO_SEQUENCE;
+}
+
+// =================================================================================================
+size_t EngagementHistory::GetSize() const
+{
+   return static_cast<size_t>(std::min(mLastSequence, static_cast<Sequence>(mKeys.size())));
+}
+
+// =================================================================================================
+void EngagementHistory::Append(const Engagement& aEngagement, double aSimTime)
+{
+   auto sequence = ++mLastSequence;
+   auto slot     = GetSlot(sequence);
+
+   //! Overwrite the oldest outcome, if any. If it is the most recent outcome for its
+   //! engagement, that engagement no longer has any outcomes retained.
+   if (mSequences[slot] != cNO_SEQUENCE)
+   {
+      auto latestPtr = mLatest.Find(mKeys[slot]);
+      if (latestPtr && (*latestPtr == mSequences[slot]))
+      {
+         mLatest.Erase(mKeys[slot]);
+      }
+   }
+
+   auto key    = aEngagement.GetKey();
+   auto result = mLatest.Emplace(key, sequence);
+   if (!result.second)
+   {
+      mPrevious[slot] = *result.first;
+      *result.first   = sequence;
+   }
+   else
+   {
+      mPrevious[slot] = cNO_SEQUENCE;
+   }
+
+   mSequences[slot]             = sequence;
+   mKeys[slot]                  = key;
+   mTimeAttackStart[slot]       = aEngagement.GetAttackStartTime();
+   mTimeAttackEnd[slot]         = aSimTime;
+   mAttackDraw[slot]            = static_cast<float>(aEngagement.GetAttackDraw());
+   mStatusReportDraw[slot]      = static_cast<float>(aEngagement.GetStatusReportDraw());
+   mAttackDetectionDraw[slot]   = static_cast<float>(aEngagement.GetAttackDetectionDraw());
+   mAttackAttributionDraw[slot] = static_cast<float>(aEngagement.GetAttackAttributionDraw());
+   mImmunityDraw[slot]          = static_cast<float>(aEngagement.GetImmunityDraw());
+   mFailureReason[slot]         = static_cast<std::uint8_t>(aEngagement.GetAttackFailureReason());
+
+   std::uint8_t flags = 0U;
+   if (aEngagement.GetAttackSuccess())
+   {
+      flags |= cATTACK_SUCCESS;
+   }
+   if (aEngagement.GetStatusReportSuccess())
+   {
+      flags |= cSTATUS_REPORTED;
+   }
+   if (aEngagement.GetTimeAttackDiscovered() >= 0.0)
+   {
+      flags |= cATTACK_DETECTED;
+   }
+   if (DrawSucceeded(aEngagement.GetAttackAttributionDraw(), aEngagement.GetAttackAttributionThreshold()))
+   {
+      flags |= cATTACK_ATTRIBUTED;
+   }
+   if (DrawSucceeded(aEngagement.GetImmunityDraw(), aEngagement.GetImmunityThreshold()))
+   {
+      flags |= cIMMUNITY;
+   }
+   if (aEngagement.GetTimeAttackRecovery() >= 0.0)
+   {
+      flags |= cRECOVERED;
+   }
+   mFlags[slot] = flags;
+}
+
+// =================================================================================================
+size_t EngagementHistory::GetCount(size_t aKey) const
+{
+   size_t count     = 0U;
+   auto   latestPtr = mLatest.Find(aKey);
+   auto   sequence  = latestPtr ? *latestPtr : cNO_SEQUENCE;
+   while (IsRetained(sequence))
+   {
+      ++count;
+      sequence = mPrevious[GetSlot(sequence)];
+   }
+
+   return count;
+}
+
+// =================================================================================================
+bool EngagementHistory::GetRecord(size_t aKey, size_t aIndex, Record& aRecord) const
+{
+   auto latestPtr = mLatest.Find(aKey);
+   auto sequence  = latestPtr ? *latestPtr : cNO_SEQUENCE;
+   for (size_t i = 0U; (i < aIndex) && IsRetained(sequence); ++i)
+   {
+      sequence = mPrevious[GetSlot(sequence)];
+   }
+
+   if (!IsRetained(sequence))
+   {
+      return false;
+   }
+
+   aRecord = GetRecordAtSlot(GetSlot(sequence));
+   return true;
+}
+
+// =================================================================================================
+std::vector<EngagementHistory::Record> EngagementHistory::GetRecords(size_t aKey) const
+{
+   std::vector<Record> records;
+   auto                latestPtr = mLatest.Find(aKey);
+   auto                sequence  = latestPtr ? *latestPtr : cNO_SEQUENCE;
+   while (IsRetained(sequence))
+   {
+      auto slot = GetSlot(sequence);
+      records.push_back(GetRecordAtSlot(slot));
+      sequence = mPrevious[slot];
+   }
+
+   return records;
+}
+
+// =================================================================================================
+void EngagementHistory::Clear()
+{
+   SetCapacity(GetCapacity());
+}
+
+// =================================================================================================
+bool EngagementHistory::IsRetained(Sequence aSequence) const
+{
+   //! Outcomes are overwritten oldest first, so a chain ends at the first outcome no longer retained.
+   return ((aSequence != cNO_SEQUENCE) && (mSequences[GetSlot(aSequence)] == aSequence));
+}
+
+// =================================================================================================
+EngagementHistory::Record EngagementHistory::GetRecordAtSlot(size_t aSlot) const
+{
+   Record record;
+   record.mKey                   = mKeys[aSlot];
+   record.mTimeAttackStart       = mTimeAttackStart[aSlot];
+   record.mTimeAttackEnd         = mTimeAttackEnd[aSlot];
+   record.mAttackDraw            = mAttackDraw[aSlot];
+   record.mStatusReportDraw      = mStatusReportDraw[aSlot];
+   record.mAttackDetectionDraw   = mAttackDetectionDraw[aSlot];
+   record.mAttackAttributionDraw = mAttackAttributionDraw[aSlot];
+   record.mImmunityDraw          = mImmunityDraw[aSlot];
+   record.mFailureReason         = static_cast<Engagement::CyberAttackFailure>(mFailureReason[aSlot]);
+
+   auto flags               = mFlags[aSlot];
+   record.mAttackSuccess    = ((flags & cATTACK_SUCCESS) != 0U);
+   record.mStatusReported   = ((flags & cSTATUS_REPORTED) != 0U);
+   record.mAttackDetected   = ((flags & cATTACK_DETECTED) != 0U);
+   record.mAttackAttributed = ((flags & cATTACK_ATTRIBUTED) != 0U);
+   record.mImmunity         = ((flags & cIMMUNITY) != 0U);
+   record.mRecovered        = ((flags & cRECOVERED) != 0U);
+   return record;
+}
+
+} // namespace cyber
+} // namespace wsf
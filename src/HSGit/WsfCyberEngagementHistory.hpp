@@ -0,0 +1,135 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFCYBERENGAGEMENTHISTORY_HPP
+#define WSFCYBERENGAGEMENTHISTORY_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "WsfCyberEngagement.hpp"
+#include "WsfCyberFlatMap.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! A memory bounded history of completed cyber attack attempts. Each time an attack attempt
+//! completes, the outcome of that attempt is appended to the history, such that the results
+//! of previous attempts for an engagement remain available after the engagement is reused
+//! for subsequent attacks.
+//!
+//! Outcomes are stored in columns within a fixed capacity ring buffer. Once the capacity has
+//! been reached, each append overwrites the oldest outcome. Outcomes for the same engagement
+//! are chained, allowing for the retrieval of the outcomes for a single engagement key without
+//! a search of the entire history.
+class WSF_CYBER_EXPORT EngagementHistory
+{
+public:
+   //! The outcome of a single attack attempt.
+   //! Draws are -1.0 if the draw did not occur during the attempt.
+   struct Record
+   {
+      size_t                         mKey{0U};
+      double                         mTimeAttackStart{0.0};
+      double                         mTimeAttackEnd{0.0};
+      float                          mAttackDraw{-1.0F};
+      float                          mStatusReportDraw{-1.0F};
+      float                          mAttackDetectionDraw{-1.0F};
+      float                          mAttackAttributionDraw{-1.0F};
+      float                          mImmunityDraw{-1.0F};
+      Engagement::CyberAttackFailure mFailureReason{Engagement::cATTACK_NONE};
+      bool                           mAttackSuccess{false};
+      bool                           mStatusReported{false};
+      bool                           mAttackDetected{false};
+      bool                           mAttackAttributed{false};
+      bool                           mImmunity{false};
+      bool                           mRecovered{false};
+   };
+
+   static constexpr size_t cDEFAULT_CAPACITY = 65536U;
+
+   explicit EngagementHistory(size_t aCapacity = cDEFAULT_CAPACITY);
+   ~EngagementHistory()                             = default;
+   EngagementHistory(const EngagementHistory& aSrc) = delete;
+   EngagementHistory& operator=(const EngagementHistory& aRhs) = delete;
+
+   //! Sets the maximum number of outcomes retained. Any existing history is discarded.
+   void SetCapacity(size_t aCapacity);
+
+   size_t GetCapacity() const { return mKeys.size(); }
+   size_t GetSize() const;
+
+   //! Appends the outcome of the engagement's most recent attack attempt.
+   //! The time provided is the time the attempt completed.
+   void Append(const Engagement& aEngagement, double aSimTime);
+
+   //! Returns the number of outcomes retained for the engagement key.
+   size_t GetCount(size_t aKey) const;
+
+   //! Provides the outcome for the engagement key at the index, where an index of zero is the
+   //! most recent attempt. Returns false if no such outcome is retained.
+   bool GetRecord(size_t aKey, size_t aIndex, Record& aRecord) const;
+
+   //! Provides all outcomes retained for the engagement key, most recent first.
+   std::vector<Record> GetRecords(size_t aKey) const;
+
+   //! Invokes the function with each outcome retained, for all engagements, oldest first.
+   template<class FUNCTION>
+   void ForEach(FUNCTION aFunction) const
+   {
+      for (auto sequence = (mLastSequence - GetSize()) + 1U; sequence <= mLastSequence; ++sequence)
+      {
+         aFunction(GetRecordAtSlot(GetSlot(sequence)));
+      }
+   }
+
+   void Clear();
+
+private:
+   using Sequence = std::uint64_t;
+
+   //! Sequences are assigned to each outcome in order of append, starting at one.
+   //! A sequence of zero indicates no outcome.
+   static constexpr Sequence cNO_SEQUENCE = 0U;
+
+   size_t GetSlot(Sequence aSequence) const { return static_cast<size_t>((aSequence - 1U) % mKeys.size()); }
+   bool   IsRetained(Sequence aSequence) const;
+   Record GetRecordAtSlot(size_t aSlot) const;
+
+   //! Columns, indexed by slot.
+   //@{
+   std::vector<Sequence>     mSequences;
+   std::vector<Sequence>     mPrevious;
+   std::vector<size_t>       mKeys;
+   std::vector<double>       mTimeAttackStart;
+   std::vector<double>       mTimeAttackEnd;
+   std::vector<float>        mAttackDraw;
+   std::vector<float>        mStatusReportDraw;
+   std::vector<float>        mAttackDetectionDraw;
+   std::vector<float>        mAttackAttributionDraw;
+   std::vector<float>        mImmunityDraw;
+   std::vector<std::uint8_t> mFailureReason;
+   std::vector<std::uint8_t> mFlags;
+   //@}
+
+   //! The sequence of the most recent outcome for each engagement key.
+   FlatMap<Sequence> mLatest;
+   Sequence          mLastSequence{cNO_SEQUENCE};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
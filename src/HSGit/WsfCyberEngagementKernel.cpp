@@ -0,0 +1,360 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberEngagementKernel.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+namespace kernel
+{
+
+// =================================================================================================
+Kernel::Kernel(Host& aHost)
+   : mHost(aHost)
+{
+}
+
+// =================================================================================================
+std::size_t Kernel::Add(Interner::Id      aAttackTypeId,
+                        Interner::Id      aAttackerId,
+                        Interner::Id      aVictimId,
+                        const Parameters& aParameters)
+{
+   State state;
+   state.mAttackTypeId = aAttackTypeId;
+   state.mAttackerId   = aAttackerId;
+   state.mVictimId     = aVictimId;
+   state.mParameters   = aParameters;
+
+   if (mRemoved.empty())
+   {
+      state.mIndex = mEngagements.size();
+      mEngagements.push_back(state);
+   }
+   else
+   {
+      state.mIndex = mRemoved.back();
+      mRemoved.pop_back();
+      mEngagements[state.mIndex] = state;
+   }
+   return state.mIndex;
+}
+
+// =================================================================================================
+void Kernel::Remove(std::size_t aEngagement)
+{
+   mEngagements[aEngagement] = State();
+   mRemoved.push_back(aEngagement);
+}
+
+// =================================================================================================
+bool Kernel::Scan(std::size_t aEngagement)
+{
+   auto& state = mEngagements[aEngagement];
+   if (!mHost.PlatformExists(state.mVictimId))
+   {
+      return false;
+   }
+
+   //! Scans are not allowed during an attack, or while a previous scan has not resolved.
+   double time         = mHost.GetTime();
+   bool   neverScanned = (state.mScanStartTime == std::numeric_limits<double>::max());
+   if (state.mAttackInProgress || (!neverScanned && (time - state.mScanStartTime) <= state.mParameters.mScanDelay))
+   {
+      return true;
+   }
+
+   mHost.Continue(Phase::cSCAN_INITIATION, aEngagement);
+   return true;
+}
+
+// =================================================================================================
+bool Kernel::Attack(std::size_t aEngagement)
+{
+   auto& state = mEngagements[aEngagement];
+   if (!mHost.PlatformExists(state.mVictimId))
+   {
+      return false;
+   }
+
+   if (!state.mAttackInProgress)
+   {
+      mHost.Continue(Phase::cATTACK_INITIATION, aEngagement);
+   }
+   return true;
+}
+
+// =================================================================================================
+bool Kernel::Cancel(std::size_t aEngagement)
+{
+   auto& state = mEngagements[aEngagement];
+   if (!state.mAttackInProgress)
+   {
+      return false;
+   }
+
+   CompleteAttack(state);
+   return true;
+}
+
+// =================================================================================================
+void Kernel::Process(Phase aPhase, std::size_t aEngagement)
+{
+   switch (aPhase)
+   {
+   case Phase::cSCAN_INITIATION:
+      ScanInitiation(aEngagement);
+      break;
+   case Phase::cSCAN_DELAY:
+      ScanDelay(aEngagement);
+      break;
+   case Phase::cATTACK_INITIATION:
+      AttackInitiation(aEngagement);
+      break;
+   case Phase::cATTACK_DELAY:
+      AttackDelay(aEngagement);
+      break;
+   case Phase::cATTACK_DETECTION_DELAY:
+      AttackDetectionDelay(aEngagement);
+      break;
+   case Phase::cATTACK_RECOVERY_DELAY:
+      AttackRecoveryDelay(aEngagement);
+      break;
+   }
+}
+
+// =================================================================================================
+void Kernel::Clear()
+{
+   mEngagements.clear();
+   mRemoved.clear();
+}
+
+// =================================================================================================
+void Kernel::ScanInitiation(std::size_t aEngagement)
+{
+   auto& state           = mEngagements[aEngagement];
+   state.mScanResult     = ScanResult::cSCAN_NONE;
+   state.mScanAttributed = false;
+   state.mScanStartTime  = mHost.GetTime();
+   ++state.mScanAttempts;
+   mHost.Notify(Notification::cSCAN_INITIATED, state);
+
+   Proceed(Phase::cSCAN_DELAY, aEngagement, state.mParameters.mScanDelay);
+}
+
+// =================================================================================================
+void Kernel::ScanDelay(std::size_t aEngagement)
+{
+   auto& state = mEngagements[aEngagement];
+
+   if (!mHost.IsVulnerable(state))
+   {
+      state.mScanResult = ScanResult::cSCAN_NOT_VULNERABLE;
+      mHost.Notify(Notification::cSCAN_FAILED, state);
+      return;
+   }
+
+   if (mHost.IsVictimImmune(state))
+   {
+      state.mScanResult = ScanResult::cSCAN_IMMUNITY;
+      mHost.Notify(Notification::cSCAN_FAILED, state);
+      return;
+   }
+
+   //! A detected scan fails, and may be attributed to the attacker.
+   if (mHost.Draw(state, ThresholdTable::cSCAN_DETECTION))
+   {
+      state.mScanResult = ScanResult::cSCAN_DETECTED;
+      mHost.Notify(Notification::cSCAN_FAILED, state);
+      mHost.Notify(Notification::cSCAN_DETECTED, state);
+      if (mHost.Draw(state, ThresholdTable::cSCAN_ATTRIBUTION))
+      {
+         state.mScanAttributed = true;
+         mHost.Notify(Notification::cSCAN_ATTRIBUTED, state);
+      }
+      mHost.OnScanDetection(state);
+      return;
+   }
+
+   state.mScanResult = ScanResult::cSCAN_SUCCEEDED;
+   mHost.Notify(Notification::cSCAN_SUCCEEDED, state);
+}
+
+// =================================================================================================
+void Kernel::AttackInitiation(std::size_t aEngagement)
+{
+   auto& state                = mEngagements[aEngagement];
+   state.mAttackResult        = AttackResult::cATTACK_NONE;
+   state.mStatusReported      = false;
+   state.mAttackDetected      = false;
+   state.mAttackAttributed    = false;
+   state.mRecovered           = false;
+   state.mTimeAttackDetection = -1.0;
+   state.mTimeAttackRecovery  = -1.0;
+   state.mAttackStartTime     = mHost.GetTime();
+   state.mAttackInProgress    = true;
+   ++state.mAttackAttempts;
+   mHost.Notify(Notification::cATTACK_INITIATED, state);
+
+   Proceed(Phase::cATTACK_DELAY, aEngagement, state.mParameters.mDeliveryDelay);
+}
+
+// =================================================================================================
+void Kernel::AttackDelay(std::size_t aEngagement)
+{
+   auto& state      = mEngagements[aEngagement];
+   auto& parameters = state.mParameters;
+
+   //! An attacker with resources reserved by a previous attack may not attack again until released.
+   AttackResult blockedResult = AttackResult::cATTACK_NONE;
+   if (!mHost.IsVulnerable(state))
+   {
+      blockedResult = AttackResult::cATTACK_NOT_VULNERABLE;
+   }
+   else if (mHost.IsVictimImmune(state))
+   {
+      blockedResult = AttackResult::cATTACK_IMMUNITY;
+   }
+   else if (mHost.HasConstraintReservations(state) || !mHost.MeetsAttackerConstraints(state))
+   {
+      blockedResult = AttackResult::cATTACK_INSUFFICIENT_RESOURCES;
+   }
+
+   if (blockedResult != AttackResult::cATTACK_NONE)
+   {
+      state.mAttackResult = blockedResult;
+      CompleteAttack(state);
+      mHost.Notify(Notification::cATTACK_FAILED, state);
+      return;
+   }
+
+   if (!mHost.Draw(state, ThresholdTable::cATTACK_SUCCESS))
+   {
+      state.mAttackResult   = AttackResult::cATTACK_RANDOM_DRAW;
+      state.mStatusReported = mHost.Draw(state, ThresholdTable::cSTATUS_REPORT);
+      CompleteAttack(state);
+      mHost.Notify(Notification::cATTACK_FAILED, state);
+      return;
+   }
+
+   //! Resources are only reserved once the attack succeeds.
+   mHost.MakeConstraintReservations(state);
+   state.mAttackResult   = AttackResult::cATTACK_SUCCEEDED;
+   state.mStatusReported = mHost.Draw(state, ThresholdTable::cSTATUS_REPORT);
+   mHost.Notify(Notification::cATTACK_SUCCEEDED, state);
+
+   if (mHost.Draw(state, ThresholdTable::cATTACK_DETECTION))
+   {
+      //! If the detection delay exceeds the duration, the attack ends before it is detected.
+      if (parameters.mDetectionDelay != 0.0 && parameters.mDuration > 0.0 &&
+          parameters.mDetectionDelay > parameters.mDuration)
+      {
+         Proceed(Phase::cATTACK_RECOVERY_DELAY, aEngagement, parameters.mDuration);
+      }
+      else
+      {
+         Proceed(Phase::cATTACK_DETECTION_DELAY, aEngagement, parameters.mDetectionDelay);
+      }
+   }
+   else if (parameters.mDuration > 0.0)
+   {
+      Proceed(Phase::cATTACK_RECOVERY_DELAY, aEngagement, parameters.mDuration);
+   }
+   else
+   {
+      CompleteAttack(state);
+   }
+}
+
+// =================================================================================================
+void Kernel::AttackDetectionDelay(std::size_t aEngagement)
+{
+   auto&  state      = mEngagements[aEngagement];
+   auto&  parameters = state.mParameters;
+   double time       = mHost.GetTime();
+
+   state.mAttackDetected      = true;
+   state.mTimeAttackDetection = time;
+   mHost.Notify(Notification::cATTACK_DETECTED, state);
+
+   if (mHost.Draw(state, ThresholdTable::cATTACK_ATTRIBUTION))
+   {
+      state.mAttackAttributed = true;
+      mHost.Notify(Notification::cATTACK_ATTRIBUTED, state);
+   }
+   mHost.OnAttackDetection(state);
+
+   //! Recovery occurs after the recovery delay, or at the end of the duration, whichever is first.
+   double attackTimeLeft = parameters.mDuration - (time - state.mAttackStartTime);
+   if (parameters.mRecoveryDelay != 0.0 && parameters.mDuration > 0.0 && attackTimeLeft < parameters.mRecoveryDelay)
+   {
+      Proceed(Phase::cATTACK_RECOVERY_DELAY, aEngagement, attackTimeLeft);
+   }
+   else
+   {
+      Proceed(Phase::cATTACK_RECOVERY_DELAY, aEngagement, parameters.mRecoveryDelay);
+   }
+}
+
+// =================================================================================================
+void Kernel::AttackRecoveryDelay(std::size_t aEngagement)
+{
+   auto& state      = mEngagements[aEngagement];
+   auto& parameters = state.mParameters;
+
+   mHost.OnAttackRecovery(state);
+   if (parameters.mRecovery || parameters.mDuration > 0.0)
+   {
+      mHost.RestoreVictim(state);
+      state.mRecovered          = true;
+      state.mTimeAttackRecovery = mHost.GetTime();
+
+      //! Immunity is only possible if the attack lasted long enough to be detected.
+      if (parameters.mDuration <= 0.0 || parameters.mDuration >= parameters.mDetectionDelay)
+      {
+         if (mHost.Draw(state, ThresholdTable::cIMMUNITY))
+         {
+            mHost.SetVictimImmune(state);
+         }
+      }
+      mHost.Notify(Notification::cATTACK_RECOVERY, state);
+   }
+
+   CompleteAttack(state);
+}
+
+// =================================================================================================
+void Kernel::CompleteAttack(State& aState)
+{
+   aState.mAttackInProgress = false;
+   mHost.Notify(Notification::cATTACK_COMPLETED, aState);
+}
+
+// =================================================================================================
+void Kernel::Proceed(Phase aPhase, std::size_t aEngagement, double aDelay)
+{
+   if (aDelay == 0.0)
+   {
+      mHost.Continue(aPhase, aEngagement);
+   }
+   else
+   {
+      mHost.Schedule(mHost.GetTime() + aDelay, aPhase, aEngagement);
+   }
+}
+
+} // namespace kernel
+} // namespace cyber
+} // namespace wsf
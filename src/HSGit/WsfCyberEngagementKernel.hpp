@@ -0,0 +1,239 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERENGAGEMENTKERNEL_HPP
+#define WSFCYBERENGAGEMENTKERNEL_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+
+#include "WsfCyberInterner.hpp"
+#include "WsfCyberThresholdTable.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+namespace kernel
+{
+
+//! The phases of the scan and attack progressions. The initiation phases are entered upon a
+//! request, and are never scheduled.
+enum class Phase
+{
+   cSCAN_INITIATION,
+   cSCAN_DELAY,
+   cATTACK_INITIATION,
+   cATTACK_DELAY,
+   cATTACK_DETECTION_DELAY,
+   cATTACK_RECOVERY_DELAY
+};
+
+//! The notifications provided to the host, corresponding to the cyber observer callbacks.
+enum class Notification
+{
+   cSCAN_INITIATED,
+   cSCAN_SUCCEEDED,
+   cSCAN_FAILED,
+   cSCAN_DETECTED,
+   cSCAN_ATTRIBUTED,
+   cATTACK_INITIATED,
+   cATTACK_SUCCEEDED,
+   cATTACK_FAILED,
+   cATTACK_DETECTED,
+   cATTACK_ATTRIBUTED,
+   cATTACK_RECOVERY,
+   cATTACK_COMPLETED,
+   cNOTIFICATION_COUNT
+};
+
+enum class ScanResult
+{
+   cSCAN_NONE,
+   cSCAN_SUCCEEDED,
+   cSCAN_IMMUNITY,
+   cSCAN_DETECTED,
+   cSCAN_NOT_VULNERABLE
+};
+
+enum class AttackResult
+{
+   cATTACK_NONE,
+   cATTACK_SUCCEEDED,
+   cATTACK_RANDOM_DRAW,
+   cATTACK_IMMUNITY,
+   cATTACK_NOT_VULNERABLE,
+   cATTACK_INSUFFICIENT_RESOURCES
+};
+
+//! The resolved inputs of an engagement, as provided by the engagement thresholds and the
+//! attack and protect definitions.
+struct Parameters
+{
+   ThresholdTable::Values mThresholds{};
+   double                 mScanDelay{0.0};
+   double                 mDeliveryDelay{0.0};
+   double                 mDetectionDelay{0.0};
+   double                 mRecoveryDelay{0.0};
+   double                 mDuration{0.0};
+   bool                   mRecovery{false};
+};
+
+//! The state of a single engagement. This is plain data, and may be copied freely.
+struct State
+{
+   std::size_t  mIndex{0U};
+   Interner::Id mAttackTypeId{Interner::cNULL_ID};
+   Interner::Id mAttackerId{Interner::cNULL_ID};
+   Interner::Id mVictimId{Interner::cNULL_ID};
+   Parameters   mParameters{};
+
+   ScanResult   mScanResult{ScanResult::cSCAN_NONE};
+   AttackResult mAttackResult{AttackResult::cATTACK_NONE};
+   bool         mAttackInProgress{false};
+   bool         mStatusReported{false};
+   bool         mAttackDetected{false};
+   bool         mAttackAttributed{false};
+   bool         mScanAttributed{false};
+   bool         mRecovered{false};
+
+   double mScanStartTime{std::numeric_limits<double>::max()};
+   double mAttackStartTime{std::numeric_limits<double>::max()};
+   double mTimeAttackDetection{-1.0};
+   double mTimeAttackRecovery{-1.0};
+
+   std::uint32_t mScanAttempts{0U};
+   std::uint32_t mAttackAttempts{0U};
+};
+
+//! The services required by the kernel from its environment. The kernel has no knowledge of the
+//! simulation, platforms or observers, and relies upon the host for each of these.
+class WSF_CYBER_EXPORT Host
+{
+public:
+   Host()          = default;
+   virtual ~Host() = default;
+
+   //! Returns the current time.
+   virtual double GetTime() const = 0;
+
+   //! Schedules the phase of an engagement. The host must call Kernel::Process() at the time provided.
+   virtual void Schedule(double aTime, Phase aPhase, std::size_t aEngagement) = 0;
+
+   //! Continues with a phase of an engagement that has no delay. The host must call Kernel::Process()
+   //! before returning, and may use this to measure or trace each phase.
+   virtual void Continue(Phase aPhase, std::size_t aEngagement) = 0;
+
+   //! Returns true if the platform exists.
+   virtual bool PlatformExists(Interner::Id aPlatformId) const = 0;
+
+   //! Returns true if the draw for the threshold of the engagement succeeds.
+   virtual bool Draw(const State& aState, ThresholdTable::Threshold aThreshold) = 0;
+
+   //! Immunity is a property of the victim for an attack type, and is shared by every attacker.
+   virtual bool IsVictimImmune(const State& aState) const = 0;
+   virtual void SetVictimImmune(const State& aState)      = 0;
+
+   //! Provides notification of the progression of an engagement.
+   virtual void Notify(Notification aNotification, const State& aState) = 0;
+
+   //! Optional checks performed prior to the draws of a scan or attack. By default, the victim is
+   //! vulnerable, and the attacker has the resources for the attack with none held by a previous attack.
+   //@{
+   virtual bool IsVulnerable(const State& aState) { return true; }
+   virtual bool HasConstraintReservations(const State& aState) { return false; }
+   virtual bool MeetsAttackerConstraints(const State& aState) { return true; }
+   //@}
+
+   //! Optional actions during the progression. The attacker resources are reserved when an attack
+   //! succeeds, and the victim is restored upon recovery, prior to the draw for immunity. The
+   //! detection and recovery hooks correspond to the protect scripts of the same name.
+   //@{
+   virtual void MakeConstraintReservations(const State& aState) {}
+   virtual void RestoreVictim(const State& aState) {}
+   virtual void OnScanDetection(const State& aState) {}
+   virtual void OnAttackDetection(const State& aState) {}
+   virtual void OnAttackRecovery(const State& aState) {}
+   //@}
+};
+
+//! The TSDEER scan and attack progressions, without dependence upon the simulation. Engagements
+//! are identified by their index, which remains valid until the engagement is removed. The
+//! EngagementManager drives the kernel through a host for the simulation, which provides the
+//! effects, user defined scripts and observers.
+//! @note States are held in a deque, such that references remain valid when the host adds an
+//! engagement during a notification.
+class WSF_CYBER_EXPORT Kernel
+{
+public:
+   explicit Kernel(Host& aHost);
+   ~Kernel()                  = default;
+   Kernel(const Kernel& aSrc) = delete;
+   Kernel& operator=(const Kernel& aRhs) = delete;
+
+   //! Adds an engagement, returning its index. The index of a removed engagement may be reused.
+   std::size_t Add(Interner::Id      aAttackTypeId,
+                   Interner::Id      aAttackerId,
+                   Interner::Id      aVictimId,
+                   const Parameters& aParameters);
+
+   //! Removes an engagement. Any phase scheduled for the engagement must no longer be processed.
+   void Remove(std::size_t aEngagement);
+
+   //! Requests a scan or attack for the engagement. Returns false if the victim does not exist.
+   //! As with the EngagementManager, a request made while a previous request is still in
+   //! progress is valid, but is otherwise ignored.
+   //@{
+   bool Scan(std::size_t aEngagement);
+   bool Attack(std::size_t aEngagement);
+   //@}
+
+   //! Ends an attack in progress, as if it had completed. Returns false if no attack is in progress.
+   bool Cancel(std::size_t aEngagement);
+
+   //! Continues the progression of an engagement upon reaching a phase.
+   void Process(Phase aPhase, std::size_t aEngagement);
+
+   const State& Get(std::size_t aEngagement) const { return mEngagements[aEngagement]; }
+   State&       Get(std::size_t aEngagement) { return mEngagements[aEngagement]; }
+
+   //! Returns the number of indices in use, including those of removed engagements.
+   std::size_t GetSize() const { return mEngagements.size(); }
+
+   void Clear();
+
+private:
+   void ScanInitiation(std::size_t aEngagement);
+   void ScanDelay(std::size_t aEngagement);
+   void AttackInitiation(std::size_t aEngagement);
+   void AttackDelay(std::size_t aEngagement);
+   void AttackDetectionDelay(std::size_t aEngagement);
+   void AttackRecoveryDelay(std::size_t aEngagement);
+   void CompleteAttack(State& aState);
+
+   //! Proceeds to the phase after the delay, immediately if there is no delay.
+   void Proceed(Phase aPhase, std::size_t aEngagement, double aDelay);
+
+   Host&                    mHost;
+   std::deque<State>        mEngagements;
+   std::vector<std::size_t> mRemoved;
+};
+
+} // namespace kernel
+} // namespace cyber
+} // namespace wsf
+
+#endif
@@ -11,6 +11,10 @@
 
 #include "WsfCyberEngagementManager.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include "UtException.hpp"
 #include "UtLog.hpp"
 #include "UtMemory.hpp"
 #include "WsfCyberEffectTypes.hpp"
@@ -19,25 +23,446 @@
 #include "WsfCyberProtect.hpp"
 #include "WsfCyberScenarioExtension.hpp"
 #include "WsfCyberSimulationExtension.hpp"
+#include "WsfEvent.hpp"
 #include "WsfPlatform.hpp"
 #include "WsfSimulation.hpp"
+#include "WsfSimulationObserver.hpp"
 
 namespace
 {
-size_t GetKey(const std::string& aAttackType, const std::string& aAttacker, const std::string& aVictim)
+//! Engagement keys are an exact packing of the attack type and platform identifiers.
+//! The limits provided here far exceed the number of attack types and unique platform
+//! names expected in a single simulation.
+constexpr unsigned int cATTACK_TYPE_ID_BITS = 16U;
+constexpr unsigned int cPLATFORM_ID_BITS    = 24U;
+
+//! Provides the key for the identifiers. Returns false if any identifier cannot be
+//! represented, in which case no engagement may exist using these identifiers.
+bool GetKey(size_t aAttackTypeId, size_t aAttackerId, size_t aVictimId, size_t& aKey)
+{
+   if (((aAttackTypeId >> cATTACK_TYPE_ID_BITS) != 0U) || ((aAttackerId >> cPLATFORM_ID_BITS) != 0U) ||
+       ((aVictimId >> cPLATFORM_ID_BITS) != 0U))
+   {
+      return false;
+   }
+
+   aKey = (aAttackTypeId << (2U * cPLATFORM_ID_BITS)) | (aAttackerId << cPLATFORM_ID_BITS) | aVictimId;
+   return true;
+}
+
+void RemoveFromIndex(std::vector<std::vector<size_t>>& aIndex, size_t aPlatformId, size_t aKey)
+{
+   if (aPlatformId < aIndex.size())
+   {
+      auto& keys   = aIndex[aPlatformId];
+      auto  keyPos = std::find(std::begin(keys), std::end(keys), aKey);
+      if (keyPos != std::end(keys))
+      {
+         // Order is irrelevant, so avoid shifting the remaining entries.
+         *keyPos = keys.back();
+         keys.pop_back();
+      }
+   }
+}
+
+//! Provides the parameters of the engagement kernel for an engagement.
+wsf::cyber::kernel::Parameters GetParameters(const wsf::cyber::Engagement& aEngagement)
+{
+   using wsf::cyber::ThresholdTable;
+   wsf::cyber::kernel::Parameters parameters;
+   parameters.mThresholds[ThresholdTable::cSTATUS_REPORT]      = aEngagement.GetStatusReportThreshold();
+   parameters.mThresholds[ThresholdTable::cATTACK_DETECTION]   = aEngagement.GetAttackDetectionThreshold();
+   parameters.mThresholds[ThresholdTable::cATTACK_ATTRIBUTION] = aEngagement.GetAttackAttributionThreshold();
+   parameters.mThresholds[ThresholdTable::cSCAN_DETECTION]     = aEngagement.GetScanDetectionThreshold();
+   parameters.mThresholds[ThresholdTable::cSCAN_ATTRIBUTION]   = aEngagement.GetScanAttributionThreshold();
+   parameters.mThresholds[ThresholdTable::cATTACK_SUCCESS]     = aEngagement.GetAttackSuccessThreshold();
+   parameters.mThresholds[ThresholdTable::cIMMUNITY]           = aEngagement.GetImmunityThreshold();
+   parameters.mScanDelay                                       = aEngagement.GetScanDelayTime();
+   parameters.mDeliveryDelay                                   = aEngagement.GetDeliveryDelayTime();
+   parameters.mDetectionDelay                                  = aEngagement.GetAttackDetectionDelayTime();
+   parameters.mRecoveryDelay                                   = aEngagement.GetAttackRecoveryDelayTime();
+   parameters.mDuration                                        = aEngagement.GetDuration();
+   parameters.mRecovery                                        = aEngagement.GetRecovery();
+   return parameters;
+}
+
+wsf::cyber::random::ProbabilityType GetProbabilityType(wsf::cyber::ThresholdTable::Threshold aThreshold)
+{
+   using wsf::cyber::ThresholdTable;
+   switch (aThreshold)
+   {
+   case ThresholdTable::cSTATUS_REPORT:
+      return wsf::cyber::random::cSTATUS_REPORT;
+   case ThresholdTable::cATTACK_DETECTION:
+      return wsf::cyber::random::cATTACK_DETECTION;
+   case ThresholdTable::cATTACK_ATTRIBUTION:
+      return wsf::cyber::random::cATTACK_ATTRIBUTION;
+   case ThresholdTable::cSCAN_DETECTION:
+      return wsf::cyber::random::cSCAN_DETECTION;
+   case ThresholdTable::cSCAN_ATTRIBUTION:
+      return wsf::cyber::random::cSCAN_ATTRIBUTION;
+   case ThresholdTable::cATTACK_SUCCESS:
+      return wsf::cyber::random::cATTACK_SUCCESS;
+   case ThresholdTable::cIMMUNITY:
+   default:
+      return wsf::cyber::random::cFUTURE_IMMUNITY;
+   }
+}
+
+wsf::cyber::Engagement::CyberAttackFailure GetAttackFailure(wsf::cyber::kernel::AttackResult aResult)
+{
+   using wsf::cyber::Engagement;
+   using wsf::cyber::kernel::AttackResult;
+   switch (aResult)
+   {
+   case AttackResult::cATTACK_RANDOM_DRAW:
+      return Engagement::cATTACK_RANDOM_DRAW;
+   case AttackResult::cATTACK_IMMUNITY:
+      return Engagement::cATTACK_IMMUNITY;
+   case AttackResult::cATTACK_NOT_VULNERABLE:
+      return Engagement::cATTACK_NOT_VULNERABLE;
+   case AttackResult::cATTACK_INSUFFICIENT_RESOURCES:
+      return Engagement::cATTACK_INSUFFICIENT_RESOURCES;
+   default:
+      return Engagement::cATTACK_NONE;
+   }
+}
+
+wsf::cyber::Engagement::CyberScanFailure GetScanFailure(wsf::cyber::kernel::ScanResult aResult)
 {
-   auto hash = std::hash<std::string>{}(aAttackType);
-   hash ^= std::hash<std::string>{}(aAttacker) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-   hash ^= std::hash<std::string>{}(aVictim) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+   using wsf::cyber::Engagement;
+   using wsf::cyber::kernel::ScanResult;
+   switch (aResult)
+   {
+   case ScanResult::cSCAN_IMMUNITY:
+      return Engagement::cSCAN_IMMUNITY;
+   case ScanResult::cSCAN_DETECTED:
+      return Engagement::cSCAN_DETECTED;
+   case ScanResult::cSCAN_NOT_VULNERABLE:
+      return Engagement::cSCAN_NOT_VULNERABLE;
+   default:
+      return Engagement::cSCAN_NONE;
+   }
+}
 
-   return hash;
+wsf::cyber::Event::Type GetEventType(wsf::cyber::kernel::Phase aPhase)
+{
+   using wsf::cyber::Event;
+   using wsf::cyber::kernel::Phase;
+   switch (aPhase)
+   {
+   case Phase::cSCAN_DELAY:
+      return Event::Type::cSCAN_DELAY;
+   case Phase::cATTACK_DELAY:
+      return Event::Type::cATTACK_DELAY;
+   case Phase::cATTACK_DETECTION_DELAY:
+      return Event::Type::cATTACK_DETECTION_DELAY;
+   case Phase::cATTACK_RECOVERY_DELAY:
+      return Event::Type::cATTACK_RECOVERY_DELAY;
+   default:
+      return Event::Type::cNONE;
+   }
 }
+
+//! Ends a simulation time window of the coalesced visualization. The window may have already ended
+//! by other means, e.g. coalescing disabled, in which case the update has no effect.
+class VisualizationWindowEvent : public WsfEvent
+{
+public:
+   explicit VisualizationWindowEvent(double aSimTime)
+      : WsfEvent(aSimTime)
+   {
+   }
+
+   EventDisposition Execute() override
+   {
+      wsf::cyber::EngagementManager::Get(*GetSimulation()).UpdateVisualization(GetTime());
+      return EventDisposition::cDELETE;
+   }
+};
 } // namespace
 
 namespace wsf
 {
 namespace cyber
 {
+constexpr size_t EngagementManager::EngagementData::cNO_SLOT;
+
+//! Engagements are held by the kernel using the state of the engagement at creation. The engagement
+//! remains the record of the progression for scripts and observers, and is updated upon each
+//! notification from the kernel.
+class EngagementManager::SimulationHost : public kernel::Host
+{
+public:
+   explicit SimulationHost(EngagementManager& aManager)
+      : mManager(aManager)
+   {
+   }
+
+   //! The simulation is that of every engagement held by the kernel.
+   void SetSimulation(WsfSimulation& aSimulation) { mSimulationPtr = &aSimulation; }
+
+   //! Associates the engagement data with its kernel index, or removes the association.
+   //@{
+   void Attach(EngagementData& aEngagementData);
+   void Detach(size_t aKernelIndex) { mEngagements[aKernelIndex] = nullptr; }
+   //@}
+
+   //! @name Host interface
+   //@{
+   double GetTime() const override { return mSimulationPtr->GetSimTime(); }
+   void   Schedule(double aTime, kernel::Phase aPhase, size_t aEngagement) override;
+   void   Continue(kernel::Phase aPhase, size_t aEngagement) override;
+   bool   PlatformExists(Interner::Id aPlatformId) const override;
+   bool   Draw(const kernel::State& aState, ThresholdTable::Threshold aThreshold) override;
+   bool   IsVictimImmune(const kernel::State& aState) const override;
+   void   SetVictimImmune(const kernel::State& aState) override {}
+   void   Notify(kernel::Notification aNotification, const kernel::State& aState) override;
+   bool   IsVulnerable(const kernel::State& aState) override;
+   bool   HasConstraintReservations(const kernel::State& aState) override;
+   bool   MeetsAttackerConstraints(const kernel::State& aState) override;
+   void   MakeConstraintReservations(const kernel::State& aState) override;
+   void   RestoreVictim(const kernel::State& aState) override;
+   void   OnScanDetection(const kernel::State& aState) override;
+   void   OnAttackDetection(const kernel::State& aState) override;
+   void   OnAttackRecovery(const kernel::State& aState) override;
+   //@}
+
+private:
+   EngagementData& GetData(size_t aKernelIndex) const { return *mEngagements[aKernelIndex]; }
+   Engagement&     GetEngagement(const kernel::State& aState) const { return GetData(aState.mIndex).GetEngagement(); }
+
+   EngagementManager&           mManager;
+   WsfSimulation*               mSimulationPtr{nullptr};
+   std::vector<EngagementData*> mEngagements;
+};
+
+// =================================================================================================
+void EngagementManager::SimulationHost::Attach(EngagementData& aEngagementData)
+{
+   auto kernelIndex = aEngagementData.GetKernelIndex();
+   if (mEngagements.size() <= kernelIndex)
+   {
+      mEngagements.resize(kernelIndex + 1U, nullptr);
+   }
+   mEngagements[kernelIndex] = &aEngagementData;
+}
+
+// =================================================================================================
+void EngagementManager::SimulationHost::Schedule(double aTime, kernel::Phase aPhase, size_t aEngagement)
+{
+   auto& engagement = GetData(aEngagement).GetEngagement();
+   SimulationExtension::Get(*mSimulationPtr)
+      .GetCyberEventManager()
+      .AddDelay(aTime, GetEventType(aPhase), engagement.GetVictimId(), engagement.GetKey());
+}
+
+// =================================================================================================
+void EngagementManager::SimulationHost::Continue(kernel::Phase aPhase, size_t aEngagement)
+{
+   mManager.Process(aPhase, GetData(aEngagement));
+}
+
+// =================================================================================================
+bool EngagementManager::SimulationHost::PlatformExists(Interner::Id aPlatformId) const
+{
+   return (mManager.GetPlatform(aPlatformId, *mSimulationPtr) != nullptr);
+}
+
+// =================================================================================================
+bool EngagementManager::SimulationHost::Draw(const kernel::State& aState, ThresholdTable::Threshold aThreshold)
+{
+   //! The engagement retains the value drawn, and registers any immunity with the victim.
+   return GetEngagement(aState).Draw(GetProbabilityType(aThreshold));
+}
+
+// =================================================================================================
+bool EngagementManager::SimulationHost::IsVictimImmune(const kernel::State& aState) const
+{
+   return GetEngagement(aState).IsVictimImmune();
+}
+
+// =================================================================================================
+void EngagementManager::SimulationHost::Notify(kernel::Notification aNotification, const kernel::State& aState)
+{
+   auto&  engagementData = GetData(aState.mIndex);
+   auto&  engagement     = engagementData.GetEngagement();
+   double simTime        = GetTime();
+
+   switch (aNotification)
+   {
+   case kernel::Notification::cSCAN_INITIATED:
+      mManager.Notify(ObserverRecord::cSCAN_INITIATED, engagement, simTime);
+      engagement.SetScanStartTime();
+      engagement.SetScanFailureReason(Engagement::cSCAN_NONE);
+      break;
+   case kernel::Notification::cSCAN_SUCCEEDED:
+      engagement.SetScanSuccess(true);
+      mManager.Notify(ObserverRecord::cSCAN_SUCCEEDED, engagement, simTime);
+      break;
+   case kernel::Notification::cSCAN_FAILED:
+      engagement.SetScanFailureReason(GetScanFailure(aState.mScanResult));
+      WSF_CYBER_INSTRUMENT(mManager.mInstrumentation.AddScanFailure(engagement.GetScanFailureReason()));
+      mManager.Notify(ObserverRecord::cSCAN_FAILED, engagement, simTime);
+      break;
+   case kernel::Notification::cSCAN_DETECTED:
+      mManager.Notify(ObserverRecord::cSCAN_DETECTED, engagement, simTime);
+      break;
+   case kernel::Notification::cSCAN_ATTRIBUTED:
+      mManager.Notify(ObserverRecord::cSCAN_ATTRIBUTED, engagement, simTime);
+      break;
+   case kernel::Notification::cATTACK_INITIATED:
+   {
+      engagement.SetAttackStartTime();
+      engagement.SetAttackInProgress(true);
+      engagement.SetAttackFailureReason(Engagement::cATTACK_NONE);
+      mManager.Notify(ObserverRecord::cATTACK_INITIATED, engagement, simTime);
+
+      // Add the attack time to the attackers constraint component
+      auto constraintComponent = engagement.GetAttackerConstraint();
+      if (constraintComponent)
+      {
+         constraintComponent->AddAttackTime(engagement.GetAttackTypeStringId(), simTime);
+      }
+      break;
+   }
+   case kernel::Notification::cATTACK_SUCCEEDED:
+      //! Activate all of the effects associated with this attack
+      engagement.SetAttackSuccess(true);
+      mManager.CyberAttackEffect(engagementData);
+      mManager.Notify(ObserverRecord::cATTACK_SUCCEEDED, engagement, simTime);
+      break;
+   case kernel::Notification::cATTACK_FAILED:
+      mManager.Notify(ObserverRecord::cATTACK_FAILED, engagement, simTime);
+      break;
+   case kernel::Notification::cATTACK_DETECTED:
+      mManager.Notify(ObserverRecord::cATTACK_DETECTED, engagement, simTime);
+      engagement.SetTimeAttackDiscovered();
+      break;
+   case kernel::Notification::cATTACK_ATTRIBUTED:
+      mManager.Notify(ObserverRecord::cATTACK_ATTRIBUTED, engagement, simTime);
+      break;
+   case kernel::Notification::cATTACK_RECOVERY:
+      mManager.Notify(ObserverRecord::cATTACK_RECOVERY, engagement, simTime);
+      break;
+   case kernel::Notification::cATTACK_COMPLETED:
+      if (aState.mAttackResult != kernel::AttackResult::cATTACK_SUCCEEDED)
+      {
+         engagement.SetAttackSuccess(false);
+         engagement.SetAttackFailureReason(GetAttackFailure(aState.mAttackResult));
+      }
+      else if (!aState.mAttackDetected && (aState.mParameters.mDuration <= 0.0))
+      {
+         // No chance of a recovery, so we no longer have use of the instantiated effects for this
+         // engagement. Get rid of them at this point
+         engagementData.RemoveEffects();
+      }
+      mManager.CompleteAttack(engagement);
+      break;
+   default:
+      break;
+   }
+}
+
+// =================================================================================================
+bool EngagementManager::SimulationHost::IsVulnerable(const kernel::State& aState)
+{
+   // Invoke the user defined script "IsVulnerable" here, if defined
+   auto& engagement = GetEngagement(aState);
+   bool  wasRun     = false;
+   bool  vulnerable = engagement.GetUsedProtection()->ExecuteIsVulnerable(engagement, GetTime(), wasRun);
+   return (vulnerable || !wasRun);
+}
+
+// =================================================================================================
+bool EngagementManager::SimulationHost::HasConstraintReservations(const kernel::State& aState)
+{
+   return GetEngagement(aState).ExistingConstraintReservations();
+}
+
+// =================================================================================================
+bool EngagementManager::SimulationHost::MeetsAttackerConstraints(const kernel::State& aState)
+{
+   return GetEngagement(aState).MeetsAttackerConstraints();
+}
+
+// =================================================================================================
+void EngagementManager::SimulationHost::MakeConstraintReservations(const kernel::State& aState)
+{
+   GetEngagement(aState).MakeConstraintReservations();
+}
+
+// =================================================================================================
+void EngagementManager::SimulationHost::RestoreVictim(const kernel::State& aState)
+{
+   auto&  engagementData = GetData(aState.mIndex);
+   auto&  engagement     = engagementData.GetEngagement();
+   double simTime        = GetTime();
+
+   // Invoke the recovery method for each effect associated with this attack
+   const auto& effectList = engagement.GetAttackEffects();
+   for (size_t slot = 0U; slot < effectList.size(); ++slot)
+   {
+      auto effectPtr = engagementData.GetEffect(slot);
+      if (effectPtr)
+      {
+         effectPtr->Restore(simTime, engagement);
+      }
+      else
+      {
+         auto logError = ut::log::error() << "Unable to reference cyber effect.";
+         logError.AddNote() << "Effect: " << effectList[slot];
+         throw std::runtime_error("Error in expected GetEffect() during cyber manager attack restore.");
+      }
+   }
+
+   // Set the time that recovery occurred
+   engagement.SetTimeAttackRecovery();
+
+   // After recovery, the associated events with this engagement are no longer needed.
+   // Purge them from our maintained effects
+   engagementData.RemoveEffects();
+}
+
+// =================================================================================================
+void EngagementManager::SimulationHost::OnScanDetection(const kernel::State& aState)
+{
+   // Invoke the user defined script "OnScanDetection" here, if defined
+   auto& engagement = GetEngagement(aState);
+   engagement.GetUsedProtection()->ExecuteOnScanDetection(engagement, GetTime());
+}
+
+// =================================================================================================
+void EngagementManager::SimulationHost::OnAttackDetection(const kernel::State& aState)
+{
+   // Invoke the user defined script "OnAttackDetection" here, if defined
+   auto& engagement = GetEngagement(aState);
+   engagement.GetUsedProtection()->ExecuteOnAttackDetection(engagement, GetTime());
+}
+
+// =================================================================================================
+void EngagementManager::SimulationHost::OnAttackRecovery(const kernel::State& aState)
+{
+   // Invoke the user defined script "OnAttackRecovery" here, if defined
+   auto& engagement = GetEngagement(aState);
+   engagement.GetUsedProtection()->ExecuteOnAttackRecovery(engagement, GetTime());
+}
+
+// =================================================================================================
+EngagementManager::EngagementManager()
+   : mHostPtr(ut::make_unique<SimulationHost>(*this))
+   , mKernel(*mHostPtr)
+{
+   mEngagements.Reserve(500U);
+}
+
+// =================================================================================================
+EngagementManager::~EngagementManager()
+{
+   //! Send any held visualization states while the engagements remain.
+   DisableVisualizationCoalescing();
+}
+
 // =================================================================================================
 //! Returns a modifiable instance of the cyber engagement manager
 EngagementManager& EngagementManager::Get(WsfSimulation& aSimulation)
@@ -46,24 +471,214 @@ EngagementManager& EngagementManager::Get(WsfSimulation& aSimulation)
 }
 
 // =================================================================================================
-EngagementManager::EngagementData& EngagementManager::AddEngagement(const std::string& aAttackType,
-                                                                    const std::string& aAttacker,
-                                                                    const std::string& aVictim,
-                                                                    WsfSimulation&     aSimulation)
+Interner::Id EngagementManager::GetAttackTypeId(const std::string& aAttackType, WsfSimulation& aSimulation)
 {
-   auto engagementDataPtr = FindEngagementData(aAttackType, aAttacker, aVictim);
-   if (engagementDataPtr)
+   auto id = mAttackTypeIds.Find(aAttackType);
+   if (id == Interner::cNULL_ID)
+   {
+      //! Only valid attack types are interned. Subsequent requests using this attack type
+      //! will not require this check.
+      const auto& cyberScenario = ScenarioExtension::Get(aSimulation.GetScenario());
+      auto        attackPtr     = cyberScenario.GetAttackTypes().Find(aAttackType);
+      if (attackPtr)
+      {
+         id = mAttackTypeIds.Intern(aAttackType);
+         mAttackTypeInfo.push_back(
+            ut::make_unique<AttackTypeInfo>(*attackPtr, aAttackType, id, cyberScenario.GetEffectTypes()));
+      }
+   }
+
+   return id;
+}
+
+// =================================================================================================
+Interner::Id EngagementManager::GetPlatformId(const std::string& aPlatformName, WsfSimulation& aSimulation)
+{
+   auto id = mPlatformIds.Find(aPlatformName);
+   if ((id == Interner::cNULL_ID) && aSimulation.GetPlatformByName(aPlatformName))
+   {
+      //! Only the names of platforms in the simulation are interned, such that requests naming
+      //! non-existent platforms do not grow the interner.
+      id = mPlatformIds.Intern(aPlatformName);
+   }
+
+   return id;
+}
+
+// =================================================================================================
+void EngagementManager::DecodeKey(size_t        aKey,
+                                  Interner::Id& aAttackTypeId,
+                                  Interner::Id& aAttackerId,
+                                  Interner::Id& aVictimId)
+{
+   const size_t platformMask = (size_t{1U} << cPLATFORM_ID_BITS) - 1U;
+   aAttackTypeId             = aKey >> (2U * cPLATFORM_ID_BITS);
+   aAttackerId               = (aKey >> cPLATFORM_ID_BITS) & platformMask;
+   aVictimId                 = aKey & platformMask;
+}
+
+// =================================================================================================
+Protect* EngagementManager::FindInheritedProtection(const Protect&        aProtect,
+                                                    const AttackTypeInfo& aAttackTypeInfo,
+                                                    WsfSimulation&        aSimulation)
+{
+   //! Protect objects of the same type share the same inherited types.
+   auto protectTypeId = mProtectTypeIds.Intern(aProtect.GetType());
+   auto key           = (protectTypeId << cATTACK_TYPE_ID_BITS) | aAttackTypeInfo.GetId();
+   auto resultPtr     = mInheritedProtections.Find(key);
+   if (resultPtr)
+   {
+      return *resultPtr;
+   }
+
+   Protect*    protectPtr    = nullptr;
+   const auto& cyberScenario = ScenarioExtension::Get(aSimulation.GetScenario());
+   for (const auto& parentType : aProtect.GetTypeList())
+   {
+      auto curBasePtr = cyberScenario.GetProtectTypes().Find(parentType);
+      if (curBasePtr && curBasePtr->ProtectionExists(aAttackTypeInfo.GetName()))
+      {
+         protectPtr = curBasePtr;
+         break;
+      }
+   }
+
+   mInheritedProtections.Emplace(key, protectPtr);
+   return protectPtr;
+}
+
+// =================================================================================================
+ThresholdTable::Row EngagementManager::GetThresholdRow(const Protect*        aProtectTypePtr,
+                                                       const AttackTypeInfo& aAttackTypeInfo)
+{
+   //! Rows defined by the attack type alone use a protect type identifier of zero.
+   size_t protectTypeId = aProtectTypePtr ? (mThresholdProtectTypeIds.Intern(aProtectTypePtr->GetName()) + 1U) : 0U;
+   size_t key           = (protectTypeId << cATTACK_TYPE_ID_BITS) | aAttackTypeInfo.GetId();
+   auto   row           = mThresholds.Find(key);
+   if (row != ThresholdTable::cNO_ROW)
+   {
+      return row;
+   }
+
+   const auto&            attackType = aAttackTypeInfo.GetName();
+   const auto&            attack     = aAttackTypeInfo.GetAttack();
+   ThresholdTable::Values values{};
+   if (aProtectTypePtr)
+   {
+      //! Attribution is only defined by the attack type.
+      values[ThresholdTable::cSTATUS_REPORT]      = aProtectTypePtr->GetProbabilityOfStatusReport(attackType);
+      values[ThresholdTable::cATTACK_DETECTION]   = aProtectTypePtr->GetProbabilityOfAttackDetection(attackType);
+      values[ThresholdTable::cATTACK_ATTRIBUTION] = attack.GetProbabilityOfAttackAttribution();
+      values[ThresholdTable::cSCAN_DETECTION]     = aProtectTypePtr->GetProbabilityOfScanDetection(attackType);
+      values[ThresholdTable::cSCAN_ATTRIBUTION]   = attack.GetProbabilityOfScanAttribution();
+      values[ThresholdTable::cATTACK_SUCCESS]     = aProtectTypePtr->GetProbabilityOfAttackSuccess(attackType);
+      values[ThresholdTable::cIMMUNITY]           = aProtectTypePtr->GetProbabilityOfFutureImmunity(attackType);
+   }
+   else
+   {
+      values[ThresholdTable::cSTATUS_REPORT]      = attack.GetProbabilityOfStatusReport();
+      values[ThresholdTable::cATTACK_DETECTION]   = attack.GetProbabilityOfAttackDetection();
+      values[ThresholdTable::cATTACK_ATTRIBUTION] = attack.GetProbabilityOfAttackAttribution();
+      values[ThresholdTable::cSCAN_DETECTION]     = attack.GetProbabilityOfScanDetection();
+      values[ThresholdTable::cSCAN_ATTRIBUTION]   = attack.GetProbabilityOfScanAttribution();
+      values[ThresholdTable::cATTACK_SUCCESS]     = attack.GetProbabilityOfAttackSuccess();
+      values[ThresholdTable::cIMMUNITY]           = attack.GetProbabilityOfFutureImmunity();
+   }
+
+   return mThresholds.Add(key, values);
+}
+
+// =================================================================================================
+WsfPlatform* EngagementManager::GetPlatform(Interner::Id aPlatformId, WsfSimulation& aSimulation)
+{
+   if (!mPlatformIds.IsValid(aPlatformId))
+   {
+      return nullptr;
+   }
+
+   if (aPlatformId >= mPlatformIndices.size())
+   {
+      mPlatformIndices.resize(mPlatformIds.GetSize(), 0U);
+   }
+
+   auto& platformIndex = mPlatformIndices[aPlatformId];
+   auto  platformPtr   = aSimulation.GetPlatformByIndex(platformIndex);
+   if (!platformPtr)
+   {
+      //! Either this identifier has not yet been resolved, or the platform previously
+      //! using this name has been removed from the simulation. Resolve by name.
+      platformPtr   = aSimulation.GetPlatformByName(mPlatformIds.GetName(aPlatformId));
+      platformIndex = platformPtr ? platformPtr->GetIndex() : 0U;
+   }
+
+   return platformPtr;
+}
+
+// =================================================================================================
+EngagementManager::EngagementData& EngagementManager::AddEngagement(Interner::Id   aAttackTypeId,
+                                                                    Interner::Id   aAttackerId,
+                                                                    Interner::Id   aVictimId,
+                                                                    WsfSimulation& aSimulation)
+{
+   auto existingPtr = FindEngagementData(aAttackTypeId, aAttackerId, aVictimId);
+   if (existingPtr)
    {
-      return *engagementDataPtr;
+      return *existingPtr;
    }
 
-   auto key = GetKey(aAttackType, aAttacker, aVictim);
+   size_t key = 0U;
+   if (!GetKey(aAttackTypeId, aAttackerId, aVictimId, key))
+   {
+      auto out = ut::log::error() << "Cyber engagement identifiers exceed the supported range.";
+      out.AddNote() << "Attack Type Identifier: " << aAttackTypeId;
+      out.AddNote() << "Attacker Identifier: " << aAttackerId;
+      out.AddNote() << "Victim Identifier: " << aVictimId;
+      throw UtException("Unable to create an engagement key in wsf::cyber::EngagementManager.");
+   }
 
-   Engagement     engagement(aAttacker, aVictim, aAttackType, aSimulation, key);
-   EngagementData engagementData(std::move(engagement));
-   auto           it = mEngagements.emplace(key, std::move(engagementData));
+   EngagementPool::Pointer engagementDataPtr;
+   if ((aAttackTypeId < mRecycledEngagements.size()) && !mRecycledEngagements[aAttackTypeId].empty())
+   {
+      //! Reuse engagement data previously used with this attack type.
+      engagementDataPtr = std::move(mRecycledEngagements[aAttackTypeId].back());
+      mRecycledEngagements[aAttackTypeId].pop_back();
+      --mRecycledCount;
+
+      engagementDataPtr->GetEngagement().Retarget(mPlatformIds.GetName(aAttackerId),
+                                                  mPlatformIds.GetName(aVictimId),
+                                                  GetAttackTypeInfo(aAttackTypeId),
+                                                  key,
+                                                  aAttackerId,
+                                                  aVictimId);
+   }
+   else
+   {
+      Engagement engagement(mPlatformIds.GetName(aAttackerId),
+                            mPlatformIds.GetName(aVictimId),
+                            GetAttackTypeInfo(aAttackTypeId),
+                            aSimulation,
+                            key,
+                            aAttackerId,
+                            aVictimId);
+      engagementDataPtr = mEngagementPool.Make(std::move(engagement), mEffectPool);
+   }
+   auto result = mEngagements.Emplace(key, std::move(engagementDataPtr));
 
-   return it.first->second;
+   auto indexSize = std::max(aAttackerId, aVictimId) + 1U;
+   if (mVictimIndex.size() < indexSize)
+   {
+      mVictimIndex.resize(indexSize);
+      mAttackerIndex.resize(indexSize);
+   }
+   mVictimIndex[aVictimId].push_back(key);
+   mAttackerIndex[aAttackerId].push_back(key);
+
+   auto& engagementData = **result.first;
+   engagementData.SetKernelIndex(
+      mKernel.Add(aAttackTypeId, aAttackerId, aVictimId, GetParameters(engagementData.GetEngagement())));
+   mHostPtr->SetSimulation(aSimulation);
+   mHostPtr->Attach(engagementData);
+   return engagementData;
 }
 
 // =================================================================================================
@@ -71,7 +686,27 @@ Engagement* EngagementManager::FindEngagement(const std::string& aAttackType,
                                               const std::string& aAttacker,
                                               const std::string& aVictim)
 {
-   return FindEngagement(GetKey(aAttackType, aAttacker, aVictim));
+   auto engagementDataPtr = FindEngagementData(aAttackType, aAttacker, aVictim);
+   if (engagementDataPtr)
+   {
+      return &engagementDataPtr->GetEngagement();
+   }
+
+   return nullptr;
+}
+
+// =================================================================================================
+Engagement* EngagementManager::FindEngagement(Interner::Id aAttackTypeId,
+                                              Interner::Id aAttackerId,
+                                              Interner::Id aVictimId)
+{
+   auto engagementDataPtr = FindEngagementData(aAttackTypeId, aAttackerId, aVictimId);
+   if (engagementDataPtr)
+   {
+      return &engagementDataPtr->GetEngagement();
+   }
+
+   return nullptr;
 }
 
 // =================================================================================================
@@ -83,471 +718,603 @@ Engagement* EngagementManager::FindEngagement(size_t aKey)
       return &engagementDataPtr->GetEngagement();
    }
 
-   return nullptr;
+   return nullptr;
+}
+
+// =================================================================================================
+EngagementManager::EngagementData* EngagementManager::FindEngagementByPlatform(const std::string& aName, bool aByVictim)
+{
+   const auto& index      = aByVictim ? mVictimIndex : mAttackerIndex;
+   auto        platformId = mPlatformIds.Find(aName);
+   if (platformId >= index.size() || index[platformId].empty())
+   {
+      return nullptr;
+   }
+
+   return FindEngagementData(index[platformId].front());
+}
+
+// =================================================================================================
+EngagementManager::EngagementData* EngagementManager::FindEngagementData(const std::string& aAttackType,
+                                                                         const std::string& aAttacker,
+                                                                         const std::string& aVictim)
+{
+   //! Names that have not been interned cannot be associated with an engagement.
+   auto attackTypeId = mAttackTypeIds.Find(aAttackType);
+   auto attackerId   = mPlatformIds.Find(aAttacker);
+   auto victimId     = mPlatformIds.Find(aVictim);
+   if ((attackTypeId == Interner::cNULL_ID) || (attackerId == Interner::cNULL_ID) || (victimId == Interner::cNULL_ID))
+   {
+      return nullptr;
+   }
+
+   return FindEngagementData(attackTypeId, attackerId, victimId);
+}
+
+// =================================================================================================
+EngagementManager::EngagementData* EngagementManager::FindEngagementData(Interner::Id aAttackTypeId,
+                                                                         Interner::Id aAttackerId,
+                                                                         Interner::Id aVictimId)
+{
+   size_t key = 0U;
+   if (!GetKey(aAttackTypeId, aAttackerId, aVictimId, key))
+   {
+      return nullptr;
+   }
+
+   return FindEngagementData(key);
+}
+
+// =================================================================================================
+EngagementManager::EngagementData* EngagementManager::FindEngagementData(size_t aKey)
+{
+   auto engagementDataPtr = mEngagements.Find(aKey);
+   if (engagementDataPtr)
+   {
+      return engagementDataPtr->get();
+   }
+
+   return nullptr;
+}
+
+// =================================================================================================
+bool EngagementManager::CyberAttack(const std::string& aAttackType,
+                                    const std::string& aAttacker,
+                                    const std::string& aVictim,
+                                    WsfSimulation&     aSimulation,
+                                    AttackParameters*  aParameters) // = nullptr
+{
+   //! Check the attack name for validity
+   auto attackTypeId = GetAttackTypeId(aAttackType, aSimulation);
+   if (attackTypeId == Interner::cNULL_ID)
+   {
+      return false;
+   }
+
+   return CyberAttack(attackTypeId,
+                      GetPlatformId(aAttacker, aSimulation),
+                      GetPlatformId(aVictim, aSimulation),
+                      aSimulation,
+                      aParameters);
+}
+
+// =================================================================================================
+bool EngagementManager::CyberAttack(Interner::Id      aAttackTypeId,
+                                    Interner::Id      aAttackerId,
+                                    Interner::Id      aVictimId,
+                                    WsfSimulation&    aSimulation,
+                                    AttackParameters* aParameters) // = nullptr
+{
+   //! Check the identifiers for validity
+   if (!mAttackTypeIds.IsValid(aAttackTypeId) || !mPlatformIds.IsValid(aAttackerId))
+   {
+      return false;
+   }
+
+   //! Check that the target platform exists.
+   if (!GetPlatform(aVictimId, aSimulation))
+   {
+      return false;
+   }
+
+   //! The engagement is created if this is a new engagement.
+   auto& engagementData = AddEngagement(aAttackTypeId, aAttackerId, aVictimId, aSimulation);
+   auto  kernelIndex    = engagementData.GetKernelIndex();
+
+   //! If an attack is still in progress, the kernel ignores this request, and waits for the
+   //! attack to resolve. The request is still valid and ongoing (from the perspective of the
+   //! attacker), but the parameters of this request are not used.
+   if (aParameters && !mKernel.Get(kernelIndex).mAttackInProgress)
+   {
+      engagementData.AddParameters(*aParameters);
+   }
+   return mKernel.Attack(kernelIndex);
+}
+
+// =================================================================================================
+void EngagementManager::Process(kernel::Phase aPhase, EngagementData& aEngagementData)
+{
+   auto&  engagement  = aEngagementData.GetEngagement();
+   double simTime     = engagement.GetSimulation().GetSimTime();
+   auto   kernelIndex = aEngagementData.GetKernelIndex();
+
+   switch (aPhase)
+   {
+   case kernel::Phase::cSCAN_INITIATION:
+   {
+      engagement.Reset(true);
+      WSF_CYBER_INSTRUMENT(mInstrumentation.ReportIfDue(simTime));
+      if (mTraceWriterPtr)
+      {
+         mTraceWriterPtr->BeginAttempt(engagement, true, simTime);
+      }
+      TraceWriter::Scope traceScope(mTraceWriterPtr.get(), "CyberScanInitialize", engagement, true);
+      mKernel.Process(aPhase, kernelIndex);
+      break;
+   }
+   case kernel::Phase::cSCAN_DELAY:
+   {
+      WSF_CYBER_INSTRUMENT_PHASE(mInstrumentation, Instrumentation::cSCAN);
+
+      //! Every scan attempt ends here, regardless of outcome.
+      TraceWriter::Scope traceScope(mTraceWriterPtr.get(), "CyberScan", engagement, true);
+      if (mTraceWriterPtr)
+      {
+         mTraceWriterPtr->EndAttempt(engagement, true, simTime);
+      }
+      mKernel.Process(aPhase, kernelIndex);
+      break;
+   }
+   case kernel::Phase::cATTACK_INITIATION:
+   {
+      WSF_CYBER_INSTRUMENT_PHASE(mInstrumentation, Instrumentation::cDELIVERY);
+      engagement.Reset();
+      WSF_CYBER_INSTRUMENT(mInstrumentation.ReportIfDue(simTime));
+      if (mTraceWriterPtr)
+      {
+         mTraceWriterPtr->BeginAttempt(engagement, false, simTime);
+      }
+      TraceWriter::Scope traceScope(mTraceWriterPtr.get(), "CyberAttackInitialize", engagement, false);
+      mKernel.Process(aPhase, kernelIndex);
+      break;
+   }
+   case kernel::Phase::cATTACK_DELAY:
+   {
+      WSF_CYBER_INSTRUMENT_PHASE(mInstrumentation, Instrumentation::cEXPLOIT);
+      TraceWriter::Scope traceScope(mTraceWriterPtr.get(), "CyberAttack", engagement, false);
+      mKernel.Process(aPhase, kernelIndex);
+      break;
+   }
+   case kernel::Phase::cATTACK_DETECTION_DELAY:
+   {
+      WSF_CYBER_INSTRUMENT_PHASE(mInstrumentation, Instrumentation::cDETECTION);
+      TraceWriter::Scope traceScope(mTraceWriterPtr.get(), "CyberAttackDetectionDelay", engagement, false);
+      mKernel.Process(aPhase, kernelIndex);
+      break;
+   }
+   case kernel::Phase::cATTACK_RECOVERY_DELAY:
+   {
+      WSF_CYBER_INSTRUMENT_PHASE(mInstrumentation, Instrumentation::cRECOVERY);
+      TraceWriter::Scope traceScope(mTraceWriterPtr.get(), "CyberAttackRecoveryDelay", engagement, false);
+      mKernel.Process(aPhase, kernelIndex);
+      break;
+   }
+   }
+}
+
+// =================================================================================================
+bool EngagementManager::EvaluateScan(const std::string&              aAttackType,
+                                     const std::string&              aAttacker,
+                                     const std::string&              aVictim,
+                                     WsfSimulation&                  aSimulation,
+                                     AnalyticEvaluator::ScanOutcome& aOutcome)
+{
+   return Evaluate(aAttackType,
+                   aAttacker,
+                   aVictim,
+                   aSimulation,
+                   [&aOutcome](Engagement& aEngagement) { aOutcome = AnalyticEvaluator::EvaluateScan(aEngagement); });
+}
+
+// =================================================================================================
+bool EngagementManager::EvaluateAttack(const std::string&                aAttackType,
+                                       const std::string&                aAttacker,
+                                       const std::string&                aVictim,
+                                       WsfSimulation&                    aSimulation,
+                                       AnalyticEvaluator::AttackOutcome& aOutcome)
+{
+   return Evaluate(aAttackType,
+                   aAttacker,
+                   aVictim,
+                   aSimulation,
+                   [&aOutcome](Engagement& aEngagement) { aOutcome = AnalyticEvaluator::EvaluateAttack(aEngagement); });
+}
+
+// =================================================================================================
+bool EngagementManager::Evaluate(const std::string&                        aAttackType,
+                                 const std::string&                        aAttacker,
+                                 const std::string&                        aVictim,
+                                 WsfSimulation&                            aSimulation,
+                                 const std::function<void(Engagement&)>& aEvaluation)
+{
+   auto attackTypeId = GetAttackTypeId(aAttackType, aSimulation);
+   auto attackerId   = GetPlatformId(aAttacker, aSimulation);
+   auto victimId     = GetPlatformId(aVictim, aSimulation);
+   if ((attackTypeId == Interner::cNULL_ID) || (attackerId == Interner::cNULL_ID) ||
+       !GetPlatform(victimId, aSimulation))
+   {
+      return false;
+   }
+
+   auto existingPtr = FindEngagementData(attackTypeId, attackerId, victimId);
+   if (existingPtr)
+   {
+      aEvaluation(existingPtr->GetEngagement());
+      return true;
+   }
+
+   size_t key = 0U;
+   if (!GetKey(attackTypeId, attackerId, victimId, key))
+   {
+      return false;
+   }
+
+   // Evaluation is a planning query, and does not create an engagement in the simulation.
+   Engagement engagement(mPlatformIds.GetName(attackerId),
+                         mPlatformIds.GetName(victimId),
+                         GetAttackTypeInfo(attackTypeId),
+                         aSimulation,
+                         key,
+                         attackerId,
+                         victimId);
+   aEvaluation(engagement);
+   return true;
 }
 
 // =================================================================================================
-EngagementManager::EngagementMap::iterator EngagementManager::FindEngagementByPlatform(const std::string& aName,
-                                                                                       bool               aByVictim)
+bool EngagementManager::EnableTrace(const std::string& aFileName, size_t aCapacity) // = TraceWriter::cDEFAULT_CAPACITY
 {
-   // Faster to check conditional now than multiple times below.
-   if (aByVictim)
+   mTraceWriterPtr.reset();
+
+   auto traceWriterPtr = ut::make_unique<TraceWriter>(aFileName, aCapacity);
+   if (!traceWriterPtr->IsOpen())
    {
-      return std::find_if(std::begin(mEngagements),
-                          std::end(mEngagements),
-                          [aName](EngagementMap::value_type& aData)
-                          { return aData.second.GetEngagement().GetVictim() == aName; });
+      auto logError = ut::log::error() << "Unable to open cyber trace file.";
+      logError.AddNote() << "File: " << aFileName;
+      return false;
    }
 
-   return std::find_if(std::begin(mEngagements),
-                       std::end(mEngagements),
-                       [aName](EngagementMap::value_type& aData)
-                       { return aData.second.GetEngagement().GetAttacker() == aName; });
+   mTraceWriterPtr = std::move(traceWriterPtr);
+   return true;
 }
 
 // =================================================================================================
-EngagementManager::EngagementData* EngagementManager::FindEngagementData(const std::string& aAttackType,
-                                                                         const std::string& aAttacker,
-                                                                         const std::string& aVictim)
+void EngagementManager::CompleteAttack(Engagement& aEngagement)
 {
-   return FindEngagementData(GetKey(aAttackType, aAttacker, aVictim));
+   WSF_CYBER_INSTRUMENT(mInstrumentation.AddAttackFailure(aEngagement.GetAttackFailureReason()));
+   aEngagement.SetAttackInProgress(false);
+   if (mTraceWriterPtr)
+   {
+      mTraceWriterPtr->EndAttempt(aEngagement, false, aEngagement.GetSimulation().GetSimTime());
+   }
+   mHistory.Append(aEngagement, aEngagement.GetSimulation().GetSimTime());
 }
 
 // =================================================================================================
-EngagementManager::EngagementData* EngagementManager::FindEngagementData(size_t aKey)
+ObserverDispatcher& EngagementManager::EnableAsyncObservers(bool   aRetainSynchronous, // = false
+                                                            size_t aCapacity) // = ObserverDispatcher::cDEFAULT_CAPACITY
 {
-   auto it = mEngagements.find(aKey);
-   if (it != std::end(mEngagements))
+   if (!mObserverDispatcherPtr)
    {
-      return &it->second;
+      mObserverDispatcherPtr = ut::make_unique<ObserverDispatcher>(aCapacity);
    }
-
-   return nullptr;
+   mSynchronousObservers = aRetainSynchronous;
+   return *mObserverDispatcherPtr;
 }
 
 // =================================================================================================
-bool EngagementManager::CyberAttack(const std::string& aAttackType,
-                                    const std::string& aAttacker,
-                                    const std::string& aVictim,
-                                    WsfSimulation&     aSimulation,
-                                    AttackParameters*  aParameters) // = nullptr
+void EngagementManager::DisableAsyncObservers()
 {
-   //! Check the attack name for validity
-   if (!ScenarioExtension::Get(aSimulation.GetScenario()).GetAttackTypeExists(aAttackType))
+   if (mObserverDispatcherPtr)
    {
-      return false;
+      mObserverDispatcherPtr->Stop();
+      mObserverDispatcherPtr.reset();
    }
+   mSynchronousObservers = true;
+}
 
-   //! Check that the target platform exists.
-   WsfPlatform* aVictimPlat = aSimulation.GetPlatformByName(aVictim);
-   if (!aVictimPlat)
+// =================================================================================================
+void EngagementManager::Notify(ObserverRecord::Type aType, Engagement& aEngagement, double aSimTime)
+{
+   if (mObserverDispatcherPtr)
    {
-      return false;
+      ObserverRecord record;
+      record.mSequence       = 0U;
+      record.mSimTime        = aSimTime;
+      record.mKey            = aEngagement.GetKey();
+      record.mType           = aType;
+      record.mAttackFailure  = static_cast<std::uint8_t>(aEngagement.GetAttackFailureReason());
+      record.mScanFailure    = static_cast<std::uint8_t>(aEngagement.GetScanFailureReason());
+      record.mStatusReported = aEngagement.GetStatusReportSuccess();
+      mObserverDispatcherPtr->Post(record);
    }
 
-   auto curEngagementDataPtr = FindEngagementData(aAttackType, aAttacker, aVictim);
-   if (curEngagementDataPtr)
+   if (mSynchronousObservers)
    {
-      //! An engagement already exists for this attacker/victim/attack type combination.
-      //! If an attack isn't in progress, then proceed with this attack.
-      //! Otherwise, an attack is still in progress, and this call attempt will fail.
-      if (!curEngagementDataPtr->GetEngagement().GetAttackInProgress())
+      auto& sim = aEngagement.GetSimulation();
+      switch (aType)
       {
-         if (aParameters)
-         {
-            curEngagementDataPtr->AddParameters(*aParameters);
-         }
-         CyberAttackInitialize(*curEngagementDataPtr);
-         return true;
+      case ObserverRecord::cATTACK_INITIATED:
+         WsfObserver::CyberAttackInitiated (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cATTACK_SUCCEEDED:
+         WsfObserver::CyberAttackSucceeded (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cATTACK_FAILED:
+         WsfObserver::CyberAttackFailed (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cATTACK_DETECTED:
+         WsfObserver::CyberAttackDetected (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cATTACK_ATTRIBUTED:
+         WsfObserver::CyberAttackAttributed (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cATTACK_RECOVERY:
+         WsfObserver::CyberAttackRecovery (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cSCAN_INITIATED:
+         WsfObserver::CyberScanInitiated (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cSCAN_SUCCEEDED:
+         WsfObserver::CyberScanSucceeded (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cSCAN_FAILED:
+         WsfObserver::CyberScanFailed (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cSCAN_DETECTED:
+         WsfObserver::CyberScanDetected (&sim)(aSimTime, aEngagement);
+         break;
+      case ObserverRecord::cSCAN_ATTRIBUTED:
+         WsfObserver::CyberScanAttributed (&sim)(aSimTime, aEngagement);
+         break;
       }
-      //! An attack was previously requested by this attacker, and the time has not elapsed since
-      //! the attack has resolved. We terminate any further processing for this request, and wait
-      //! for the attack to resolve. We still return true, however, as the request was valid
-      //! and ongoing (from the perspective of the attacker)
-      return true;
    }
-   //! No engagement object. This is a new engagement. Proceed with algorithm.
-   curEngagementDataPtr = &AddEngagement(aAttackType, aAttacker, aVictim, aSimulation);
 
-   if (aParameters)
+   //! Visualization is always provided on the simulation thread, regardless of the observer mode.
+   switch (aType)
    {
-      curEngagementDataPtr->AddParameters(*aParameters);
+   case ObserverRecord::cATTACK_INITIATED:
+   case ObserverRecord::cATTACK_SUCCEEDED:
+   case ObserverRecord::cATTACK_FAILED:
+   case ObserverRecord::cSCAN_INITIATED:
+   case ObserverRecord::cSCAN_SUCCEEDED:
+   case ObserverRecord::cSCAN_FAILED:
+      Visualize(aType, aEngagement, aSimTime);
+      break;
+   default:
+      break;
    }
-   CyberAttackInitialize(*curEngagementDataPtr);
-   return true;
 }
 
 // =================================================================================================
-void EngagementManager::CyberAttackInitialize(EngagementData& aEngagementData)
+void EngagementManager::EnableVisualizationCoalescing(VisualizationFeed::Window aWindowType,
+                                                      double                    aWindow,
+                                                      WsfSimulation&            aSimulation)
 {
-   auto& engagement = aEngagementData.GetEngagement();
-
-   engagement.Reset();
-
-   auto& sim = engagement.GetSimulation();
-   engagement.SetAttackStartTime();
-   engagement.SetAttackInProgress(true);
-
-   //! Reset the attack failure reason from any previous attempts
-   engagement.SetAttackFailureReason(Engagement::cATTACK_NONE);
-
-   //! Notify the observer that an attack has begun
-   WsfObserver::CyberAttackInitiated (&sim)(sim.GetSimTime(), engagement);
-   VisualizationManager::Get(sim).AttackInitiated(engagement);
-
-   // Add the attack time to the attackers constraint component
-   auto constraintComponent = Constraint::Find(*(sim.GetPlatformByName(engagement.GetAttacker())));
-   constraintComponent->AddAttackTime(engagement.GetAttackType(), sim.GetSimTime());
+   DisableVisualizationCoalescing();
+
+   //! Simulation time windows end with a scheduled event. Wall clock windows are checked as time advances.
+   auto scheduler = [&aSimulation](double aSimTime)
+   { aSimulation.AddEvent(ut::make_unique<VisualizationWindowEvent>(aSimTime)); };
+   mVisualizationFeedPtr = ut::make_unique<VisualizationFeed>(SendVisualization, aWindowType, aWindow, scheduler);
+   mVisualizationCallbacks.Add(
+      WsfObserver::AdvanceTime(&aSimulation).Connect(&EngagementManager::UpdateVisualization, this));
+   mVisualizationCallbacks.Add(
+      WsfObserver::SimulationComplete(&aSimulation).Connect(&EngagementManager::CompleteVisualization, this));
+}
 
-   if (engagement.GetDeliveryDelayTime() == 0.0)
+// =================================================================================================
+void EngagementManager::DisableVisualizationCoalescing()
+{
+   mVisualizationCallbacks.Clear();
+   if (mVisualizationFeedPtr)
    {
-      //! No delivery delay. Immediately begin the attack
-      CyberAttack(aEngagementData);
-      return;
+      mVisualizationFeedPtr->Flush();
+      mVisualizationFeedPtr.reset();
    }
-   //! Model a delay for the delivery phase. Schedule the event and return to the
-   //! attack algorithm upon completion
-   auto event = ut::make_unique<Event>((sim.GetSimTime() + engagement.GetDeliveryDelayTime()),
-                                       Event::Type::cATTACK_DELAY,
-                                       engagement.GetVictim(),
-                                       engagement.GetKey());
-
-   SimulationExtension::Get(sim).GetCyberEventManager().AddEvent(std::move(event));
 }
 
 // =================================================================================================
-void EngagementManager::CyberAttack(EngagementData& aEngagementData)
+void EngagementManager::UpdateVisualization(double aSimTime)
 {
-   auto&  engagement = aEngagementData.GetEngagement();
-   auto&  sim        = engagement.GetSimulation();
-   double simTime    = sim.GetSimTime();
-
-   // Invoke the user defined script "IsVulnerable" here, if defined
-   bool     wasRun     = false;
-   Protect* protect    = engagement.GetUsedProtection();
-   bool     vulnerable = protect->ExecuteIsVulnerable(engagement, simTime, wasRun);
-   if (!vulnerable && wasRun)
-   {
-      // The attack has failed due to a user defined reason
-      engagement.SetAttackInProgress(false);
-      engagement.SetAttackSuccess(false);
-      engagement.SetAttackFailureReason(Engagement::cATTACK_NOT_VULNERABLE);
-      WsfObserver::CyberAttackFailed (&sim)(simTime, engagement);
-      VisualizationManager::Get(sim).AttackFailed(engagement);
-
-      return;
-   }
-
-   //! The target may be outright immune to the attack due to previous attacks.
-   //! In this case, the attack fails.
-   if (engagement.IsVictimImmune())
+   if (mVisualizationFeedPtr)
    {
-      engagement.SetAttackInProgress(false);
-      engagement.SetAttackSuccess(false);
-      engagement.SetAttackFailureReason(Engagement::cATTACK_IMMUNITY);
-
-      WsfObserver::CyberAttackFailed (&sim)(simTime, engagement);
-      VisualizationManager::Get(sim).AttackFailed(engagement);
-
-      return;
+      mVisualizationFeedPtr->Update(aSimTime);
    }
+}
 
-   //! The attack may have some resource requirement associated with it.
-   //! If the attacker does not have enough resources the attack fails.
-   //! If the attacker already allocated resources the attack fails.
-   if (engagement.ExistingConstraintReservations() || !engagement.MeetsAttackerConstraints())
+// =================================================================================================
+void EngagementManager::CompleteVisualization(double aSimTime)
+{
+   if (mVisualizationFeedPtr)
    {
-      engagement.SetAttackInProgress(false);
-      engagement.SetAttackSuccess(false);
-      engagement.SetAttackFailureReason(Engagement::cATTACK_INSUFFICIENT_RESOURCES);
-      WsfObserver::CyberAttackFailed (&sim)(simTime, engagement);
-      VisualizationManager::Get(sim).AttackFailed(engagement);
-
-      return;
+      mVisualizationFeedPtr->Flush();
    }
+}
 
-   //! The attack is not blocked and may proceed. Determine attack success by
-   //! probabilistic draw
-   bool attackSuccess = engagement.Draw(random::cATTACK_SUCCESS);
-
-   if (attackSuccess)
+// =================================================================================================
+void EngagementManager::Visualize(ObserverRecord::Type aState, Engagement& aEngagement, double aSimTime)
+{
+   if (mVisualizationFeedPtr)
    {
-      // The resource reservations should only be attempted after the attack succeeds.
-      engagement.MakeConstraintReservations();
-
-      //! Mark the attack as completed and successful
-      engagement.SetAttackSuccess(true);
-
-      //! Determine if the outcome of the attack is reported to the attacker.
-      engagement.Draw(random::cSTATUS_REPORT);
-
-      //! Activate all of the effects associated with this attack
-      CyberAttackEffect(aEngagementData);
-
-      //! Mark the attack as completed and successful
-      engagement.SetAttackSuccess(true);
-      WsfObserver::CyberAttackSucceeded (&sim)(simTime, engagement);
-      VisualizationManager::Get(sim).AttackSucceeded(engagement);
-
-      //! Determine if the victim can detect the attack
-      bool attackDetected = engagement.Draw(random::cATTACK_DETECTION);
-      if (attackDetected)
-      {
-         // Schedule the continuation of the attack progression after the defined attack detection delay time
-         // If the detection delay time is 0.0, just jump straight to the next method
-         double attackDelayTime    = engagement.GetAttackDetectionDelayTime();
-         double engagementDuration = engagement.GetDuration();
-         if (attackDelayTime == 0.0)
-         {
-            CyberAttackDetectionDelay(aEngagementData);
-         }
-         else
-         {
-            // Schedule event in the future after the completion of the attack delay time
-            // but only if Detection Delay is less than the duration of the cyber attack.
-            // if Detection Delay is greater than the duration, it will recover first and not be detected
-            if (engagementDuration > 0.0 && attackDelayTime > engagementDuration)
-            {
-               // Time to detect attack is greater than Duration, so attack will finish first
-
-               auto event = ut::make_unique<Event>((simTime + engagementDuration),
-                                                   Event::Type::cATTACK_RECOVERY_DELAY,
-                                                   engagement.GetVictim(),
-                                                   engagement.GetKey());
-
-               SimulationExtension::Get(sim).GetCyberEventManager().AddEvent(std::move(event));
-            }
-            else
-            {
-               // detects attack before the cyber attack ends
-
-               auto event = ut::make_unique<Event>((simTime + attackDelayTime),
-                                                   Event::Type::cATTACK_DETECTION_DELAY,
-                                                   engagement.GetVictim(),
-                                                   engagement.GetKey());
-
-               SimulationExtension::Get(sim).GetCyberEventManager().AddEvent(std::move(event));
-            }
-         }
-      }
-      else // attack not detected - end of attack progression
-      {
-         // check for duration. If it exists, schedule a recovery. Otherwise, remove the engagement.
-         if (engagement.GetDuration() > 0.0)
-         {
-            // Schedule a delay event for potential recovery actions
-            auto event = ut::make_unique<Event>((simTime + engagement.GetDuration()),
-                                                Event::Type::cATTACK_RECOVERY_DELAY,
-                                                engagement.GetVictim(),
-                                                engagement.GetKey());
-
-            SimulationExtension::Get(sim).GetCyberEventManager().AddEvent(std::move(event));
-         }
-         else
-         {
-            // No chance of a recovery, so we no longer have use of the instantiated effects for this
-            // engagement. Get rid of them at this point
-            aEngagementData.RemoveEffects();
-            // No further processing or delays. Set end of engagement for reuse.
-            engagement.SetAttackInProgress(false);
-         }
-      }
+      mVisualizationFeedPtr->Post(aState, aEngagement, aSimTime);
    }
    else
    {
-      engagement.SetAttackSuccess(false);
-      engagement.SetAttackInProgress(false);
-      engagement.SetAttackFailureReason(Engagement::cATTACK_RANDOM_DRAW);
+      SendVisualization(aState, aEngagement);
+   }
+}
 
-      //! Determine if the outcome of the attack is reported to the attacker.
-      engagement.Draw(random::cSTATUS_REPORT);
-      WsfObserver::CyberAttackFailed (&sim)(simTime, engagement);
-      VisualizationManager::Get(sim).AttackFailed(engagement);
+// =================================================================================================
+void EngagementManager::SendVisualization(ObserverRecord::Type aState, Engagement& aEngagement)
+{
+   auto& visualization = VisualizationManager::Get(aEngagement.GetSimulation());
+   switch (aState)
+   {
+   case ObserverRecord::cATTACK_INITIATED:
+      visualization.AttackInitiated(aEngagement);
+      break;
+   case ObserverRecord::cATTACK_SUCCEEDED:
+      visualization.AttackSucceeded(aEngagement);
+      break;
+   case ObserverRecord::cATTACK_FAILED:
+      visualization.AttackFailed(aEngagement);
+      break;
+   case ObserverRecord::cSCAN_INITIATED:
+      visualization.ScanInitiated(aEngagement);
+      break;
+   case ObserverRecord::cSCAN_SUCCEEDED:
+      visualization.ScanSucceeded(aEngagement);
+      break;
+   case ObserverRecord::cSCAN_FAILED:
+      visualization.ScanFailed(aEngagement);
+      break;
+   default:
+      break;
    }
 }
 
 // =================================================================================================
 void EngagementManager::CyberAttackEffect(EngagementData& aEngagementData)
 {
+   WSF_CYBER_INSTRUMENT_PHASE(mInstrumentation, Instrumentation::cEFFECT);
    auto&  engagement = aEngagementData.GetEngagement();
    auto&  sim        = engagement.GetSimulation();
    double simTime    = sim.GetSimTime();
 
    //! Add effects and kick off each effect
-   const auto& effectList = engagement.GetAttackEffects();
-   for (const auto& effect : effectList)
+   auto effectCount = engagement.GetAttackEffects().size();
+   for (size_t slot = 0U; slot < effectCount; ++slot)
    {
-      auto& addedEffect = aEngagementData.AddEffect(effect);
+      auto& addedEffect = aEngagementData.AddEffect(slot);
       addedEffect.Attack(simTime, engagement);
    }
 }
 
 // =================================================================================================
-void EngagementManager::CyberAttackDetectionDelay(EngagementData& aEngagementData)
+bool EngagementManager::CyberScan(const std::string& aAttackType,
+                                  const std::string& aAttacker,
+                                  const std::string& aVictim,
+                                  WsfSimulation&     aSimulation)
 {
-   auto&  engagement = aEngagementData.GetEngagement();
-   auto&  sim        = engagement.GetSimulation();
-   double simTime    = sim.GetSimTime();
-
-   // Notify the observer that the attack has been detected
-   WsfObserver::CyberAttackDetected (&sim)(simTime, engagement);
-
-   // Update detection time
-   engagement.SetTimeAttackDiscovered();
-
-   //! Determine if the victim can attribute the attack to the attacking platform
-   bool attackAttributed = engagement.Draw(random::cATTACK_ATTRIBUTION);
-   if (attackAttributed)
+   //! Check the attack name for validity
+   auto attackTypeId = GetAttackTypeId(aAttackType, aSimulation);
+   if (attackTypeId == Interner::cNULL_ID)
    {
-      // Notify the observer that the attack has been attributed
-      WsfObserver::CyberAttackAttributed (&sim)(simTime, engagement);
+      return false;
    }
 
-   // Invoke the user defined script "OnAttackDetection" here, if defined
-   Protect* protect = engagement.GetUsedProtection();
-   protect->ExecuteOnAttackDetection(engagement, simTime);
+   return CyberScan(attackTypeId,
+                    GetPlatformId(aAttacker, aSimulation),
+                    GetPlatformId(aVictim, aSimulation),
+                    aSimulation);
+}
 
-   double recoveryDelayTime = engagement.GetAttackRecoveryDelayTime();
-   if (recoveryDelayTime == 0.0)
+// =================================================================================================
+bool EngagementManager::CyberScan(Interner::Id   aAttackTypeId,
+                                  Interner::Id   aAttackerId,
+                                  Interner::Id   aVictimId,
+                                  WsfSimulation& aSimulation)
+{
+   //! Check the identifiers for validity
+   if (!mAttackTypeIds.IsValid(aAttackTypeId) || !mPlatformIds.IsValid(aAttackerId))
    {
-      // No delay. Immediately call next attack progression method
-      CyberAttackRecoveryDelay(aEngagementData);
+      return false;
    }
-   else
-   {
-      // Schedule a delay event for potential recovery actions
-      // Schedule it for attack recovery delay, or end duration, whichever comes first.
-      double attackTimeLeft = engagement.GetDuration() - (simTime - engagement.GetAttackStartTime());
-      if (engagement.GetDuration() > 0.0 && attackTimeLeft < recoveryDelayTime)
-      {
-         assert(attackTimeLeft > 0.0);
-         auto event = ut::make_unique<Event>((simTime + attackTimeLeft),
-                                             Event::Type::cATTACK_RECOVERY_DELAY,
-                                             engagement.GetVictim(),
-                                             engagement.GetKey());
-
-         SimulationExtension::Get(sim).GetCyberEventManager().AddEvent(std::move(event));
-      }
-      else
-      {
-         auto event = ut::make_unique<Event>((simTime + recoveryDelayTime),
-                                             Event::Type::cATTACK_RECOVERY_DELAY,
-                                             engagement.GetVictim(),
-                                             engagement.GetKey());
 
-         SimulationExtension::Get(sim).GetCyberEventManager().AddEvent(std::move(event));
-      }
+   //! Check that the target platform exists.
+   if (!GetPlatform(aVictimId, aSimulation))
+   {
+      return false;
    }
+
+   //! The engagement is created if this is a new engagement. If an attack is in progress, or a
+   //! previous scan has not resolved, the kernel ignores this request, and waits for the scheduled
+   //! event to resolve. The request is still valid and ongoing (from the perspective of the attacker).
+   auto& engagementData = AddEngagement(aAttackTypeId, aAttackerId, aVictimId, aSimulation);
+   return mKernel.Scan(engagementData.GetKernelIndex());
 }
 
 // =================================================================================================
-void EngagementManager::CyberAttackRecoveryDelay(EngagementData& aEngagementData)
+std::vector<bool> EngagementManager::CyberAttackBatch(const std::vector<BatchRequest>& aRequests,
+                                                      WsfSimulation&                   aSimulation)
 {
-   auto&  engagement = aEngagementData.GetEngagement();
-   auto&  sim        = engagement.GetSimulation();
-   double simTime    = sim.GetSimTime();
-
-   // Invoke the user defined script "OnAttackRecovery" here, if defined
-   auto* protect = engagement.GetUsedProtection();
-   protect->ExecuteOnAttackRecovery(engagement, simTime);
-
-   if (engagement.GetRecovery() || engagement.GetDuration() > 0.0)
+   auto              resolved = ResolveBatch(aRequests, aSimulation);
+   std::vector<bool> results(aRequests.size(), false);
+   for (size_t i = 0U; i < aRequests.size(); ++i)
    {
-      // Invoke the recovery method for each effect associated with this attack
-      const auto& effectList = engagement.GetAttackEffects();
-      for (const auto& effect : effectList)
+      const auto& ids = resolved[i];
+      if (ids.mAttackTypeId != Interner::cNULL_ID)
       {
-         auto effectPtr = aEngagementData.GetEffect(effect);
-         if (effectPtr)
-         {
-            effectPtr->Restore(simTime, engagement);
-         }
-         else
-         {
-            auto logError = ut::log::error() << "Unable to reference cyber effect.";
-            logError.AddNote() << "Effect: " << effect;
-            throw std::runtime_error("Error in expected GetEffect() during cyber manager attack restore.");
-         }
+         results[i] =
+            CyberAttack(ids.mAttackTypeId, ids.mAttackerId, ids.mVictimId, aSimulation, aRequests[i].mParametersPtr);
       }
+   }
 
-      // Set the time that recovery occurred
-      engagement.SetTimeAttackRecovery();
-
-      // After recovery, the associated events with this engagement are no longer needed.
-      // Purge them from our maintained effects
-      aEngagementData.RemoveEffects();
+   return results;
+}
 
-      // Only check immunity if the duration was larger or equal to the delay time to detect.
-      // Also check immunity if the duration was not set.
-      if (engagement.GetDuration() <= 0.0 || engagement.GetDuration() >= engagement.GetAttackDetectionDelayTime())
+// =================================================================================================
+std::vector<bool> EngagementManager::CyberScanBatch(const std::vector<BatchRequest>& aRequests,
+                                                    WsfSimulation&                   aSimulation)
+{
+   auto              resolved = ResolveBatch(aRequests, aSimulation);
+   std::vector<bool> results(aRequests.size(), false);
+   for (size_t i = 0U; i < aRequests.size(); ++i)
+   {
+      const auto& ids = resolved[i];
+      if (ids.mAttackTypeId != Interner::cNULL_ID)
       {
-         // Check for future immunity against this attack type
-         // Note - this draw call will automatically update the victim platform
-         // immunity if the draw is successful
-         engagement.Draw(random::cFUTURE_IMMUNITY);
+         results[i] = CyberScan(ids.mAttackTypeId, ids.mAttackerId, ids.mVictimId, aSimulation);
       }
-
-      // Notify the observer that the recovery step has been reached
-      WsfObserver::CyberAttackRecovery (&sim)(simTime, engagement);
    }
 
-   // The attack progression has ended for this attack iteration.
-   engagement.SetAttackInProgress(false);
+   return results;
 }
 
 // =================================================================================================
-bool EngagementManager::CyberScan(const std::string& aAttackType,
-                                  const std::string& aAttacker,
-                                  const std::string& aVictim,
-                                  WsfSimulation&     aSimulation)
+std::vector<EngagementManager::ResolvedRequest>
+EngagementManager::ResolveBatch(const std::vector<BatchRequest>& aRequests, WsfSimulation& aSimulation)
 {
-   //! Check the attack name for validity
-   if (!ScenarioExtension::Get(aSimulation.GetScenario()).GetAttackTypeExists(aAttackType))
-   {
-      return false;
-   }
+   //! Requests in a batch typically share an attack type and attacker (e.g. a salvo against
+   //! many victims). Consecutive requests reusing a name reuse its identifier without a lookup,
+   //! and invalid attack types are only validated against the scenario once per batch.
+   std::vector<ResolvedRequest> resolved;
+   resolved.reserve(aRequests.size());
 
-   //! Check that the target platform exists.
-   WsfPlatform* aVictimPlat = aSimulation.GetPlatformByName(aVictim);
-   if (!aVictimPlat)
-   {
-      return false;
-   }
+   std::unordered_map<std::string, Interner::Id> attackTypeIds;
+   const std::string*                            lastAttackerPtr = nullptr;
+   Interner::Id                                  lastAttackerId  = Interner::cNULL_ID;
 
-   auto* curEngagementDataPtr = FindEngagementData(aAttackType, aAttacker, aVictim);
-   if (curEngagementDataPtr)
+   for (const auto& request : aRequests)
    {
-      auto& engagement = curEngagementDataPtr->GetEngagement();
-      // If any attacks are currently in progress, exit
-      if (engagement.GetAttackInProgress())
+      auto attackTypeIt = attackTypeIds.find(request.mAttackType);
+      if (attackTypeIt == std::end(attackTypeIds))
       {
-         return true;
+         attackTypeIt =
+            attackTypeIds.emplace(request.mAttackType, GetAttackTypeId(request.mAttackType, aSimulation)).first;
       }
 
-      //! An engagement already exists for this attacker/victim/attack type combination.
-      //! If a scan hasn't been attempted, or has and is now expired, then proceed with this scan.
-      //! Otherwise, a scan is still in progress, and this call attempt will fail.
-      //! Note: Clang warns about the comparison of floating point values here. This is, however, safe
-      //! given the use of an internally consistent value for comparison that is not the result of
-      //! computation and potential loss of precision.
-      bool   neverScanned    = (engagement.GetScanStartTime() == std::numeric_limits<double>::max());
-      double elapsedScanTime = aSimulation.GetSimTime() - engagement.GetScanStartTime();
-      if (neverScanned || (elapsedScanTime > engagement.GetScanDelayTime()))
+      if (!lastAttackerPtr || (*lastAttackerPtr != request.mAttacker))
       {
-         //! No concurrent scan. Proceed with scan
-         CyberScanInitialize(*curEngagementDataPtr);
-         return true;
+         lastAttackerPtr = &request.mAttacker;
+         lastAttackerId  = GetPlatformId(request.mAttacker, aSimulation);
       }
-      //! A scan was previously requested by this attacker, and the time has not elapsed since
-      //! the scan has resolved. We terminate any further processing for this request, and wait
-      //! for the scheduled event to resolve. We still return true, however, as the request was valid
-      //! and ongoing (from the perspective of the attacker)
-      return true;
+
+      resolved.push_back({attackTypeIt->second, lastAttackerId, GetPlatformId(request.mVictim, aSimulation)});
    }
-   //! No engagement exists. Create it, and begin scan
-   curEngagementDataPtr = &AddEngagement(aAttackType, aAttacker, aVictim, aSimulation);
-   CyberScanInitialize(*curEngagementDataPtr);
-   return true;
+
+   return resolved;
 }
 
 // =================================================================================================
@@ -559,167 +1326,246 @@ bool EngagementManager::Cancel(size_t aKey)
       return false;
    }
 
-   auto& engagement = curEngagementDataPtr->GetEngagement();
-   engagement.SetAttackInProgress(false);
+   mKernel.Cancel(curEngagementDataPtr->GetKernelIndex());
    curEngagementDataPtr->RemoveEffects();
 
    return true;
 }
 
 // =================================================================================================
-void EngagementManager::CyberScanInitialize(EngagementData& aEngagementData)
+void EngagementManager::CullVictimEngagements(const std::string& aVictim)
+{
+   CullEngagements(mPlatformIds.Find(aVictim), true);
+}
+
+// =================================================================================================
+void EngagementManager::CullVictimEngagements(Interner::Id aVictimId)
 {
-   auto& engagement = aEngagementData.GetEngagement();
-   auto& sim        = engagement.GetSimulation();
-   engagement.Reset(true);
+   CullEngagements(aVictimId, true);
+}
 
-   //! Notify the observer that a scan has begun
-   WsfObserver::CyberScanInitiated (&sim)(sim.GetSimTime(), engagement);
-   VisualizationManager::Get(sim).ScanInitiated(engagement);
-   engagement.SetScanStartTime();
+// =================================================================================================
+void EngagementManager::CullAttackerEngagements(const std::string& aAttacker)
+{
+   CullEngagements(mPlatformIds.Find(aAttacker), false);
+}
 
-   //! Reset the scan failure reason from any previous attempts
-   engagement.SetScanFailureReason(Engagement::cSCAN_NONE);
+// =================================================================================================
+void EngagementManager::CullAttackerEngagements(Interner::Id aAttackerId)
+{
+   CullEngagements(aAttackerId, false);
+}
 
-   if (engagement.GetScanDelayTime() == 0.0)
+// =================================================================================================
+void EngagementManager::CullEngagements(Interner::Id aPlatformId, bool aByVictim)
+{
+   auto& index = aByVictim ? mVictimIndex : mAttackerIndex;
+   if ((aPlatformId >= index.size()) || index[aPlatformId].empty())
    {
-      //! No delay. Immediately begin the scanning algorithm and record results in the engagement object
-      CyberScan(aEngagementData);
+      return;
    }
-   else
+
+   //! Take ownership of the key list prior to removal, as EraseEngagement()
+   //! modifies the index entries for this platform.
+   auto keys = std::move(index[aPlatformId]);
+   index[aPlatformId].clear();
+
+   //! Scheduled events must not continue a removed engagement, or one that later reuses its key.
+   //! The events of a victim are canceled together via the victim index of the event manager.
+   auto& simulation   = FindEngagementData(keys.front())->GetEngagement().GetSimulation();
+   auto& eventManager = SimulationExtension::Get(simulation).GetCyberEventManager();
+   if (aByVictim)
    {
-      //! A delay is required. Schedule the event with the simulation to execute the scanning algorithm
-      //! at the appropriate time
-      auto event = ut::make_unique<Event>((sim.GetSimTime() + engagement.GetScanDelayTime()),
-                                          Event::Type::cSCAN_DELAY,
-                                          engagement.GetVictim(),
-                                          engagement.GetKey());
+      eventManager.CancelEvents(aPlatformId);
+   }
 
-      SimulationExtension::Get(sim).GetCyberEventManager().AddEvent(std::move(event));
+   for (auto key : keys)
+   {
+      if (!aByVictim)
+      {
+         eventManager.CancelEvent(false, key);
+         eventManager.CancelEvent(true, key);
+      }
+      EraseEngagement(key);
    }
 }
 
 // =================================================================================================
-void EngagementManager::CyberScan(EngagementData& aEngagementData)
+void EngagementManager::EraseEngagement(size_t aKey)
 {
-   auto&  engagement = aEngagementData.GetEngagement();
-   auto&  sim        = engagement.GetSimulation();
-   double simTime    = sim.GetSimTime();
-
-   // Invoke the user defined script "IsVulnerable" here, if defined
-   bool  wasRun     = false;
-   auto* protect    = engagement.GetUsedProtection();
-   bool  vulnerable = protect->ExecuteIsVulnerable(engagement, simTime, wasRun);
-   if (!vulnerable && wasRun)
-   {
-      // The scan has failed due to a user defined reason
-      engagement.SetScanFailureReason(Engagement::cSCAN_NOT_VULNERABLE);
-      WsfObserver::CyberScanFailed (&sim)(simTime, engagement);
-      VisualizationManager::Get(sim).ScanFailed(engagement);
-      return;
-   }
-
-   //! Determine if the victim is immune to this attack type
-   if (engagement.IsVictimImmune())
+   if (mVisualizationFeedPtr)
    {
-      engagement.SetScanFailureReason(Engagement::cSCAN_IMMUNITY);
-      WsfObserver::CyberScanFailed (&sim)(simTime, engagement);
-      VisualizationManager::Get(sim).ScanFailed(engagement);
-      return;
+      mVisualizationFeedPtr->Remove(aKey);
    }
 
-   //! Determine if the victim detects the scan
-   bool scanDetected = engagement.Draw(random::cSCAN_DETECTION);
-   if (scanDetected)
+   auto engagementDataPtr = mEngagements.Find(aKey);
+   if (engagementDataPtr)
    {
-      //! If the scan is detected, it fails
-      engagement.SetScanFailureReason(Engagement::cSCAN_DETECTED);
-      WsfObserver::CyberScanFailed (&sim)(simTime, engagement);
-      WsfObserver::CyberScanDetected (&sim)(simTime, engagement);
+      auto recycledPtr = std::move(*engagementDataPtr);
+      mEngagements.Erase(aKey);
 
-      //! Determine if the victim attributes the attacking platform
-      bool scanAttributed = engagement.Draw(random::cSCAN_ATTRIBUTION);
-      if (scanAttributed)
+      auto& engagement = recycledPtr->GetEngagement();
+      RemoveFromIndex(mVictimIndex, engagement.GetVictimId(), aKey);
+      RemoveFromIndex(mAttackerIndex, engagement.GetAttackerId(), aKey);
+      mKernel.Remove(recycledPtr->GetKernelIndex());
+      mHostPtr->Detach(recycledPtr->GetKernelIndex());
+
+      if (mRecycledCount < cRECYCLE_LIMIT)
       {
-         WsfObserver::CyberScanAttributed (&sim)(simTime, engagement);
-      }
+         auto attackTypeId = engagement.GetAttackTypeId();
+         if (mRecycledEngagements.size() <= attackTypeId)
+         {
+            mRecycledEngagements.resize(attackTypeId + 1U);
+         }
 
-      VisualizationManager::Get(sim).ScanFailed(engagement);
+         recycledPtr->Recycle();
+         mRecycledEngagements[attackTypeId].push_back(std::move(recycledPtr));
+         ++mRecycledCount;
+      }
+   }
+}
 
-      // Invoke the user defined script "OnScanDetection" here, if defined
-      protect->ExecuteOnScanDetection(engagement, simTime);
-      return;
+// =================================================================================================
+bool EngagementManager::EngagementExists(const std::string& aAttackType,
+                                         const std::string& aAttacker,
+                                         const std::string& aVictim) const
+{
+   auto attackTypeId = mAttackTypeIds.Find(aAttackType);
+   auto attackerId   = mPlatformIds.Find(aAttacker);
+   auto victimId     = mPlatformIds.Find(aVictim);
+   if ((attackTypeId == Interner::cNULL_ID) || (attackerId == Interner::cNULL_ID) || (victimId == Interner::cNULL_ID))
+   {
+      return false;
    }
 
-   //! At this point, the scan is now successful.
-   engagement.SetScanSuccess(true);
-   WsfObserver::CyberScanSucceeded (&sim)(simTime, engagement);
-   VisualizationManager::Get(sim).ScanSucceeded(engagement);
+   return EngagementExists(attackTypeId, attackerId, victimId);
 }
 
 // =================================================================================================
-void EngagementManager::CullVictimEngagements(const std::string& aVictim)
+bool EngagementManager::EngagementExists(Interner::Id aAttackTypeId,
+                                         Interner::Id aAttackerId,
+                                         Interner::Id aVictimId) const
+{
+   size_t key = 0U;
+   return (GetKey(aAttackTypeId, aAttackerId, aVictimId, key) && EngagementExists(key));
+}
+
+// =================================================================================================
+bool EngagementManager::EngagementExists(size_t aKey) const
+{
+   return mEngagements.Contains(aKey);
+}
+
+// =================================================================================================
+Effect* EngagementManager::EngagementData::GetEffect(const std::string& aEffectName) const
 {
-   auto it = FindEngagementByPlatform(aVictim, true);
-   if (it != std::end(mEngagements))
+   //! Effects are identified by their type identifier, such that no string comparison is required.
+   WsfStringId effectNameId(aEffectName);
+   auto        slot = FindAttackEffectSlot(effectNameId);
+   if ((slot != cNO_SLOT) && GetEffect(slot))
    {
-      mEngagements.erase(it);
+      return GetEffect(slot);
    }
+
+   //! Not an effect of the attack type, or not currently instantiated in its slot.
+   return GetEffect(FindOtherEffectSlot(effectNameId));
 }
 
 // =================================================================================================
-void EngagementManager::CullAttackerEngagements(const std::string& aAttacker)
+Effect& EngagementManager::EngagementData::AddEffect(size_t aSlot)
 {
-   auto it = FindEngagementByPlatform(aAttacker, false);
-   if (it != std::end(mEngagements))
+   const auto& effectPlan = mEngagement.GetAttackTypeInfo().GetEffectPlan();
+   if (aSlot >= effectPlan.size())
+   {
+      auto out = ut::log::error() << "Attempting to instantiate a cyber effect in an invalid slot.";
+      out.AddNote() << "Slot: " << aSlot;
+      out.AddNote() << "Attack Effects: " << effectPlan.size();
+      throw std::runtime_error("Error in effect instantiation in wsf::cyber::EngagementManager");
+   }
+
+   //! An effect already present in the slot remains, and takes precedence over this effect.
+   if (GetEffect(aSlot))
    {
-      mEngagements.erase(it);
+      return EmplaceEffect(std::max(mEffects.size(), effectPlan.size()), effectPlan[aSlot]);
    }
+   return EmplaceEffect(aSlot, effectPlan[aSlot]);
 }
 
 // =================================================================================================
-bool EngagementManager::EngagementExists(const std::string& aAttackType,
-                                         const std::string& aAttacker,
-                                         const std::string& aVictim) const
+Effect& EngagementManager::EngagementData::AddEffect(const std::string& aEffectName)
 {
-   return EngagementExists(GetKey(aAttackType, aAttacker, aVictim));
+   auto slot = FindAttackEffectSlot(WsfStringId(aEffectName));
+   if (slot != cNO_SLOT)
+   {
+      return AddEffect(slot);
+   }
+
+   //! Not an effect of the attack type, so not resolved by the attack type effect plan.
+   auto& scenario = ScenarioExtension::Get(mEngagement.GetSimulation().GetScenario());
+   return EmplaceEffect(std::max(mEffects.size(), mEngagement.GetAttackEffects().size()),
+                        AttackTypeInfo::EffectPlanEntry(aEffectName, scenario.GetEffectTypes()));
 }
 
 // =================================================================================================
-bool EngagementManager::EngagementExists(size_t aKey) const
+void EngagementManager::EngagementData::RemoveEffect(const std::string& aEffectName)
 {
-   return (mEngagements.find(aKey) != std::end(mEngagements));
+   WsfStringId effectNameId(aEffectName);
+   auto        slot = FindAttackEffectSlot(effectNameId);
+   if ((slot != cNO_SLOT) && GetEffect(slot))
+   {
+      mEffects[slot] = nullptr;
+      return;
+   }
+
+   slot = FindOtherEffectSlot(effectNameId);
+   if (slot != cNO_SLOT)
+   {
+      mEffects.erase(slot);
+   }
 }
 
 // =================================================================================================
-Effect* EngagementManager::EngagementData::GetEffect(const std::string& aEffectName) const
+size_t EngagementManager::EngagementData::FindAttackEffectSlot(WsfStringId aEffectNameId) const
 {
-   auto it =
-      std::find_if(std::begin(mEngagementEffects),
-                   std::end(mEngagementEffects),
-                   [aEffectName](const UtCloneablePtr<Effect>& aEffect) { return (aEffect->GetType() == aEffectName); });
-
-   if (it != std::end(mEngagementEffects))
+   const auto& effectPlan = mEngagement.GetAttackTypeInfo().GetEffectPlan();
+   for (size_t slot = 0U; slot < effectPlan.size(); ++slot)
    {
-      return it->get();
+      if (effectPlan[slot].mNameId == aEffectNameId)
+      {
+         return slot;
+      }
    }
+   return cNO_SLOT;
+}
 
-   return nullptr;
+// =================================================================================================
+size_t EngagementManager::EngagementData::FindOtherEffectSlot(WsfStringId aEffectNameId) const
+{
+   for (auto slot = mEngagement.GetAttackEffects().size(); slot < mEffects.size(); ++slot)
+   {
+      if (mEffects[slot]->GetTypeId() == aEffectNameId)
+      {
+         return slot;
+      }
+   }
+   return cNO_SLOT;
 }
 
 // =================================================================================================
-Effect& EngagementManager::EngagementData::AddEffect(const std::string& aEffectName)
+Effect& EngagementManager::EngagementData::EmplaceEffect(size_t                                 aSlot,
+                                                         const AttackTypeInfo::EffectPlanEntry& aPlanEntry)
 {
-   auto&                  scenario = ScenarioExtension::Get(mEngagement.GetSimulation().GetScenario());
-   UtCloneablePtr<Effect> effectPtr(scenario.GetEffectTypes().Clone(aEffectName));
-   if (!effectPtr)
+   auto prototypePtr = aPlanEntry.mPrototypePtr;
+   if (!prototypePtr)
    {
       auto out = ut::log::error() << "Attempting to instantiate a non-existent cyber effect.";
-      out.AddNote() << "Effect: " << aEffectName;
+      out.AddNote() << "Effect: " << aPlanEntry.mName;
       throw std::runtime_error("Error in effect instantiation in wsf::cyber::EngagementManager");
    }
 
-   if (effectPtr->RequiredInput() == Effect::InputRequirement::cREQUIRED)
+   //! The effect is cloned directly from the effect type, using the parameters if provided.
+   std::unique_ptr<Effect> effectPtr;
+   if (aPlanEntry.mInputRequirement == Effect::InputRequirement::cREQUIRED)
    {
       if (!mParametersValid)
       {
@@ -728,35 +1574,38 @@ Effect& EngagementManager::EngagementData::AddEffect(const std::string& aEffectN
             "Error in effect instantiation requiring valid parameters in wsf::cyber::EngagementManager");
       }
 
-      effectPtr = effectPtr->Clone(mParameters);
+      effectPtr.reset(prototypePtr->Clone(mParameters));
    }
    else if (mParametersValid) // optional user data required
    {
-      effectPtr = effectPtr->Clone(mParameters);
+      effectPtr.reset(prototypePtr->Clone(mParameters));
+   }
+   else
+   {
+      effectPtr.reset(prototypePtr->Clone());
    }
 
-   mEngagementEffects.push_back(effectPtr);
+   //! The slots of the attack type effects always exist once any effect is added.
+   auto slotCount = std::max({aSlot + 1U, mEffects.size(), mEngagement.GetAttackEffects().size()});
+   if (mEffects.size() < slotCount)
+   {
+      mEffects.resize(slotCount);
+   }
+   mEffects[aSlot] = std::move(effectPtr);
 
    // Must initialize AFTER adding to container - because WsfScriptContext has a non-semantically correct
-   // copy constructor, we need to avoid copies after it has been initialized. This also extends to why
-   // we store this in a std::list as opposed to std::vector, to avoid copy constructor calls due to
-   // automatic reallocation of the container when using std::vector.
-   mEngagementEffects.back()->Initialize(mEngagement);
-   return *mEngagementEffects.back().get();
+   // copy constructor, we need to avoid copies after it has been initialized. Effects are held by pointer,
+   // such that changes to the container never copy or move the effect itself.
+   mEffects[aSlot]->Initialize(mEngagement);
+   return *mEffects[aSlot];
 }
 
 // =================================================================================================
-void EngagementManager::EngagementData::RemoveEffect(const std::string& aEffectName)
+void EngagementManager::EngagementData::Recycle()
 {
-   auto it =
-      std::find_if(std::begin(mEngagementEffects),
-                   std::end(mEngagementEffects),
-                   [aEffectName](const UtCloneablePtr<Effect>& aEffect) { return (aEffect->GetType() == aEffectName); });
-
-   if (it != std::end(mEngagementEffects))
-   {
-      mEngagementEffects.erase(it);
-   }
+   RemoveEffects();
+   RemoveParameters();
+   mEngagement.ReleaseAttackerConstraints();
 }
 
 // =================================================================================================
@@ -776,7 +1625,7 @@ void EngagementManager::EngagementData::RemoveParameters()
 // =================================================================================================
 void EngagementManager::EngagementData::RemoveEffects()
 {
-   mEngagementEffects.clear();
+   mEffects.clear();
    RemoveParameters();
 }
 
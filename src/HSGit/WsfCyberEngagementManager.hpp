@@ -14,16 +14,41 @@
 
 #include "wsf_cyber_export.h"
 
-#include <list>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "UtCallbackHolder.hpp"
+#include "WsfCyberAnalyticEvaluator.hpp"
 #include "WsfCyberAttackParameters.hpp"
+#include "WsfCyberAttackTypeInfo.hpp"
 #include "WsfCyberEngagement.hpp"
+#include "WsfCyberEngagementHistory.hpp"
+#include "WsfCyberEngagementKernel.hpp"
+#include "WsfCyberFlatMap.hpp"
+#include "WsfCyberInstrumentation.hpp"
+#include "WsfCyberInterner.hpp"
+#include "WsfCyberObjectPool.hpp"
+#include "WsfCyberObserverDispatcher.hpp"
+#include "WsfCyberThresholdTable.hpp"
+#include "WsfCyberTraceWriter.hpp"
+#include "WsfCyberVisualizationFeed.hpp"
 #include "effects/WsfCyberEffect.hpp"
 class WsfPlatform;
 class WsfSimulation;
 
+namespace wsf
+{
+namespace cyber
+{
+class Protect;
+} // namespace cyber
+} // namespace wsf
+
 namespace wsf
 {
 namespace cyber
@@ -37,22 +62,23 @@ namespace cyber
 //! cyber usage in the simulation. Generally, any data that occurs due to events managed by
 //! the WsfCyberEngagementManager will be stored on the individual engagement object,
 //! allowing query of specific engagement details for use elsewhere. Other than the
-//! list of engagements itself, this class is stateless, and shall only provide the logic
-//! for manipulating engagements via the TSDEER cyber engagement model.
+//! list of engagements itself, this class is stateless. The TSDEER cyber engagement model is
+//! provided by the engagement kernel (see kernel::Kernel), which the manager drives through a
+//! host for the simulation, providing the effects, user defined scripts and observers.
 //! @note
 //! TSDEER mapping:
 //! Target: not modeled, provided by algorithm input (victim)
 //! Scan: Initiated by user request via scan script method call.
-//!       Modeled via the scan methods.
+//!       Modeled via the scan initiation and scan delay phases.
 //! Delivery: Initiated by user request via attack script method call.
-//!           Modeled by the CyberAttackInitialize method call (scheduled event)
+//!           Modeled via the attack initiation phase (scheduled event)
 //! Exploit: Continued automatically from Delivery phase.
-//!          Modeled via CyberAttack (protected) method.
+//!          Modeled via the attack delay phase.
 //! Effect: Continued automatically from Exploit phase.
 //!         Modeled via effect specific implementation initiated
-//!         by CyberAttack (protected) method.
+//!         by CyberAttackEffect (protected) method.
 //! React: Continued automatically from previous phases.
-//!        Modeled via CyberAttackReact (protected) method.
+//!        Modeled via the attack detection and recovery delay phases.
 class WSF_CYBER_EXPORT EngagementManager
 {
 public:
@@ -62,8 +88,10 @@ public:
    {
    public:
       //! EngagementData requires an engagement. Engagements can be moved, but not copied.
-      EngagementData(Engagement aEngagement)
+      //! The effect slots are provided by the effect pool, which must outlive this object.
+      EngagementData(Engagement aEngagement, SlotBlockPool& aEffectPool)
          : mEngagement(std::move(aEngagement))
+         , mEffects(aEffectPool)
       {
       }
       ~EngagementData() = default;
@@ -75,44 +103,133 @@ public:
       EngagementData(const EngagementData& aSrc) = delete;
       EngagementData(EngagementData&& aSrc)      = default;
 
-      Effect*                 GetEffect(const std::string& aEffectName) const;
+      //! @name Effect methods
+      //! Effects are held in slots. The effects of the engagement attack type use the slot
+      //! corresponding to their position in Engagement::GetAttackEffects(), and are accessed
+      //! directly via the slot based overloads. Any other effect added by name uses an
+      //! additional slot following these.
+      //@{
+      static constexpr size_t cNO_SLOT = std::numeric_limits<size_t>::max();
+
+      Effect* GetEffect(size_t aSlot) const { return (aSlot < mEffects.size()) ? mEffects[aSlot].get() : nullptr; }
+      Effect* GetEffect(const std::string& aEffectName) const;
+      Effect& AddEffect(size_t aSlot);
+      Effect& AddEffect(const std::string& aEffectName);
+      void    RemoveEffect(const std::string& aEffectName);
+      //@}
+
       Engagement&             GetEngagement() { return mEngagement; }
       const AttackParameters& GetParameters() const { return mParameters; }
       bool                    IsParametersValid() const { return mParametersValid; }
 
-      Effect& AddEffect(const std::string& aEffectName);
-      void    RemoveEffect(const std::string& aEffectName);
+      //! The index of the engagement state within the engagement kernel.
+      size_t GetKernelIndex() const { return mKernelIndex; }
+      void   SetKernelIndex(size_t aKernelIndex) { mKernelIndex = aKernelIndex; }
+
       void    RemoveEffects();
       void    AddParameters(const AttackParameters& aParameters);
       void    RemoveParameters();
 
+      //! Releases all effects, parameters and reservations held by the engagement,
+      //! such that it may be retargeted for reuse.
+      void Recycle();
+
    protected:
-      Engagement mEngagement;
+      //! Returns the slot for an effect of the attack type, or cNO_SLOT if the effect
+      //! is not an effect of the attack type.
+      size_t FindAttackEffectSlot(WsfStringId aEffectNameId) const;
+
+      //! Returns the slot of an instantiated effect that is not an effect of the attack type,
+      //! or cNO_SLOT if there is no such effect.
+      size_t FindOtherEffectSlot(WsfStringId aEffectNameId) const;
+
+      //! Instantiates the effect in the slot, which must be empty.
+      Effect& EmplaceEffect(size_t aSlot, const AttackTypeInfo::EffectPlanEntry& aPlanEntry);
 
-      //! Do not modify this to use another container type.
-      //! std::list is used to avoid copies on insertion and removal.
-      std::list<UtCloneablePtr<Effect>> mEngagementEffects{};
-      AttackParameters                  mParameters{};
-      bool                              mParametersValid{false};
+      //! Indexed by slot. Effects are held indirectly, such that an effect is never copied
+      //! or moved once added, as WsfScriptContext does not support copies after initialization.
+      //! An empty slot holds nullptr. The slots are held in a single block drawn from the effect pool.
+      using EffectSlots = PooledSlots<std::unique_ptr<Effect>>;
+
+      Engagement       mEngagement;
+      EffectSlots      mEffects;
+      AttackParameters mParameters{};
+      bool             mParametersValid{false};
+      size_t           mKernelIndex{0U};
    };
 
-   using EngagementMap = std::unordered_map<size_t, EngagementData>;
+   //! Engagements are keyed by an exact packing of the attack type, attacker and victim
+   //! identifiers, such that every unique combination has a unique key. The engagement data
+   //! is held indirectly, as references to engagements must remain valid as the map changes.
+   //! Engagement data storage is recycled via the engagement pool.
+   using EngagementPool = ObjectPool<EngagementData>;
+   using EngagementMap  = FlatMap<EngagementPool::Pointer>;
 
-   //! Allow the scheduled delay events to call the scan and attack methods when a delay is required.
+   //! Allow the scheduled delay events to continue the progression when a delay is required.
    //! No other classes should have outside access to these methods
    friend class Event;
 
    static EngagementManager& Get(WsfSimulation& aSimulation);
 
-   EngagementManager() { mEngagements.reserve(500U); }
-   ~EngagementManager()                             = default;
+   EngagementManager();
+   ~EngagementManager();
    EngagementManager(const EngagementManager& aSrc) = delete;
    const EngagementManager& operator=(const EngagementManager& aRhs) = delete;
 
+   //! @name Identifier methods
+   //! Attack types and platform names are interned by the engagement manager, providing dense
+   //! integer identifiers for use with the identifier based overloads of the methods in this class.
+   //! These overloads avoid the string handling required by the name based versions, and should be
+   //! preferred when the same attack types and platforms are used repeatedly.
+   //! @note An attack type identifier is only provided for attack types that exist in the scenario,
+   //! and a platform identifier is only provided for a name that has been interned or that names a
+   //! platform in the simulation. Otherwise, Interner::cNULL_ID is returned. Every attack type
+   //! identifier is associated with the attack type information shared by all engagements using
+   //! that attack type.
+   //@{
+   Interner::Id          GetAttackTypeId(const std::string& aAttackType, WsfSimulation& aSimulation);
+   const AttackTypeInfo& GetAttackTypeInfo(Interner::Id aAttackTypeId) const { return *mAttackTypeInfo[aAttackTypeId]; }
+   Interner::Id          GetPlatformId(const std::string& aPlatformName, WsfSimulation& aSimulation);
+   const Interner& GetAttackTypeIds() const { return mAttackTypeIds; }
+   const Interner& GetPlatformIds() const { return mPlatformIds; }
+
+   //! Returns the platform currently in the simulation with the name associated with
+   //! the identifier, or nullptr if no such platform exists.
+   WsfPlatform* GetPlatform(Interner::Id aPlatformId, WsfSimulation& aSimulation);
+
+   //! Provides the identifiers from which an engagement key was created.
+   static void DecodeKey(size_t aKey, Interner::Id& aAttackTypeId, Interner::Id& aAttackerId, Interner::Id& aVictimId);
+   //@}
+
+   //! Returns the first protect type inherited by the protect object that explicitly defines
+   //! protection against the attack type, or nullptr if no inherited type does so. Results are
+   //! retained for each combination of protect type and attack type, such that the search of
+   //! the inherited types occurs once for all victims sharing a protect type.
+   //! @note Protections defined directly on the protect object are not considered, as these
+   //! may differ between protect objects of the same type.
+   Protect* FindInheritedProtection(const Protect&        aProtect,
+                                    const AttackTypeInfo& aAttackTypeInfo,
+                                    WsfSimulation&        aSimulation);
+
+   //! @name Threshold methods
+   //! Engagement thresholds defined by a scenario protect type or an attack type are shared
+   //! by all engagements using that definition, and are held in the threshold table.
+   //! GetThresholdRow() provides the row for the thresholds defined by the protect type
+   //! for the attack type, or by the attack type itself if no protect type is provided,
+   //! adding the row if required.
+   //! @note Thresholds defined by the protect object of a specific platform are not held in the
+   //! table, as these may differ between protect objects of the same type.
+   //@{
+   ThresholdTable::Row   GetThresholdRow(const Protect* aProtectTypePtr, const AttackTypeInfo& aAttackTypeInfo);
+   const ThresholdTable& GetThresholdTable() const { return mThresholds; }
+   //@}
+
    Engagement* FindEngagement(const std::string& aAttackType, const std::string& aAttacker, const std::string& aVictim);
+   Engagement* FindEngagement(Interner::Id aAttackTypeId, Interner::Id aAttackerId, Interner::Id aVictimId);
    Engagement* FindEngagement(size_t aKey);
 
    bool EngagementExists(const std::string& aAttackType, const std::string& aAttacker, const std::string& aVictim) const;
+   bool EngagementExists(Interner::Id aAttackTypeId, Interner::Id aAttackerId, Interner::Id aVictimId) const;
    bool EngagementExists(size_t aKey) const;
 
    //! @name CullEngagements methods
@@ -121,9 +238,15 @@ public:
    //! An attacker specific version of this method is also provided for use cases where
    //! users want to also end engagements where the attacker is required beyond the initiation
    //! of the engagement.
+   //! @note All engagements referencing the platform are removed in a single call. The cost
+   //! is proportional to the number of engagements involving that platform, not the total
+   //! number of engagements being managed. Any scheduled events of the removed engagements
+   //! are canceled.
    //@{
    void CullVictimEngagements(const std::string& aVictim);
+   void CullVictimEngagements(Interner::Id aVictimId);
    void CullAttackerEngagements(const std::string& aAttacker);
+   void CullAttackerEngagements(Interner::Id aAttackerId);
    //@}
 
    bool CyberAttack(const std::string& aAttackType,
@@ -132,6 +255,12 @@ public:
                     WsfSimulation&     aSimulation,
                     AttackParameters*  aParameters = nullptr);
 
+   bool CyberAttack(Interner::Id      aAttackTypeId,
+                    Interner::Id      aAttackerId,
+                    Interner::Id      aVictimId,
+                    WsfSimulation&    aSimulation,
+                    AttackParameters* aParameters = nullptr);
+
    //! @name CyberScan method
    //! Initiates a scan with the given parameters. This method initially checks for the existence of
    //! current engagement objects that match the provided arguments and ensures that a scan request
@@ -142,18 +271,171 @@ public:
                   const std::string& aVictim,
                   WsfSimulation&     aSimulation);
 
+   bool CyberScan(Interner::Id   aAttackTypeId,
+                  Interner::Id   aAttackerId,
+                  Interner::Id   aVictimId,
+                  WsfSimulation& aSimulation);
+
+   //! A single request for use with the batch methods.
+   struct BatchRequest
+   {
+      std::string       mAttackType;
+      std::string       mAttacker;
+      std::string       mVictim;
+      AttackParameters* mParametersPtr{nullptr};
+   };
+
+   //! @name Batch methods
+   //! Equivalent to calling CyberAttack() or CyberScan() for each request in order, returning
+   //! the result of each request at the same position in the returned vector. Names are resolved,
+   //! and attack types validated, once per unique name in the batch instead of once per request.
+   //! @note Attack parameters are ignored by CyberScanBatch().
+   //@{
+   std::vector<bool> CyberAttackBatch(const std::vector<BatchRequest>& aRequests, WsfSimulation& aSimulation);
+   std::vector<bool> CyberScanBatch(const std::vector<BatchRequest>& aRequests, WsfSimulation& aSimulation);
+   //@}
+
+   //! @name Analytic evaluation methods
+   //! Provides the exact outcome probabilities and timings of a scan or attack attempt, without
+   //! performing the attempt or any draws (see AnalyticEvaluator). No engagement is created if
+   //! one does not already exist. Returns false if the request is not valid, as for CyberScan()
+   //! and CyberAttack(), in which case no outcome is provided.
+   //@{
+   bool EvaluateScan(const std::string&              aAttackType,
+                     const std::string&              aAttacker,
+                     const std::string&              aVictim,
+                     WsfSimulation&                  aSimulation,
+                     AnalyticEvaluator::ScanOutcome& aOutcome);
+
+   bool EvaluateAttack(const std::string&                aAttackType,
+                       const std::string&                aAttacker,
+                       const std::string&                aVictim,
+                       WsfSimulation&                    aSimulation,
+                       AnalyticEvaluator::AttackOutcome& aOutcome);
+   //@}
+
+   //! @name Draw methods
+   //! By default, engagement draws are provided by the cyber draw manager of the simulation in
+   //! the order requested, such that the order of events affects the values drawn. Counter based
+   //! draws instead provide each draw as a function of the draw seed, the engagement names, the
+   //! attempt number and the probability type (see random::CounterRandom). These draws are
+   //! reproducible regardless of the order of events, and may be evaluated concurrently.
+   //! @note The draw seed should differ for each replicate of a scenario, e.g. as provided by
+   //! ReplicationRunner::Replicate::mSeed.
+   //@{
+   void UseCounterBasedDraws(std::uint64_t aDrawSeed)
+   {
+      mCounterBasedDraws = true;
+      mDrawSeed          = aDrawSeed;
+   }
+   bool          IsCounterBasedDraws() const { return mCounterBasedDraws; }
+   std::uint64_t GetDrawSeed() const { return mDrawSeed; }
+   //@}
+
+   //! @name History methods
+   //! Provides the outcomes of completed attack attempts, which remain available
+   //! after subsequent attacks reuse an engagement.
+   //@{
+   EngagementHistory&       GetHistory() { return mHistory; }
+   const EngagementHistory& GetHistory() const { return mHistory; }
+   //@}
+
+   //! @name Instrumentation methods
+   //! Provides the phase counters and timers, failure counts and event counts, when compiled
+   //! with WSF_CYBER_INSTRUMENTATION defined. Otherwise, all values remain zero.
+   //@{
+   Instrumentation&       GetInstrumentation() { return mInstrumentation; }
+   const Instrumentation& GetInstrumentation() const { return mInstrumentation; }
+   //@}
+
+   //! @name Trace methods
+   //! Writes the handlers and attempts of every engagement to a Chrome trace file (see TraceWriter).
+   //! Tracing is disabled by default, and the trace is completed when disabled or when the
+   //! manager is destroyed. Returns false if the file could not be opened.
+   //@{
+   bool         EnableTrace(const std::string& aFileName, size_t aCapacity = TraceWriter::cDEFAULT_CAPACITY);
+   void         DisableTrace() { mTraceWriterPtr.reset(); }
+   TraceWriter* GetTraceWriter() const { return mTraceWriterPtr.get(); }
+   //@}
+
+   //! @name Asynchronous observer methods
+   //! By default, the cyber observer callbacks are invoked synchronously by the engagement
+   //! progression. When asynchronous observers are enabled, each callback is instead posted as
+   //! an ObserverRecord to the dispatcher, whose subscribers receive the records in batches on
+   //! a separate thread (see ObserverDispatcher for the ordering guarantees). The synchronous
+   //! callbacks may optionally be retained, for observers that require the engagement itself
+   //! (e.g. event output). Visualization is unaffected, and is always provided synchronously.
+   //@{
+   ObserverDispatcher& EnableAsyncObservers(bool   aRetainSynchronous = false,
+                                            size_t aCapacity          = ObserverDispatcher::cDEFAULT_CAPACITY);
+
+   //! Delivers every posted record, stops the dispatcher and restores the synchronous callbacks.
+   void                DisableAsyncObservers();
+   ObserverDispatcher* GetObserverDispatcher() const { return mObserverDispatcherPtr.get(); }
+   //@}
+
+   //! @name Visualization coalescing methods
+   //! By default, every attack and scan state change is sent to the visualization. When coalescing
+   //! is enabled, changes are held for the window provided, and only the latest state of each
+   //! engagement is sent (see VisualizationFeed). The held states are sent at the end of each window,
+   //! when the simulation completes, and when coalescing is disabled.
+   //@{
+   void EnableVisualizationCoalescing(VisualizationFeed::Window aWindowType,
+                                      double                    aWindow,
+                                      WsfSimulation&            aSimulation);
+   void DisableVisualizationCoalescing();
+
+   //! Sends the held states if the window has ended. Called as simulation time advances.
+   void               UpdateVisualization(double aSimTime);
+   VisualizationFeed* GetVisualizationFeed() const { return mVisualizationFeedPtr.get(); }
+   //@}
+
    //! @name Cancel method
    //! Stops the cyber attack progression via external request.
    bool Cancel(size_t aKey);
 
 protected:
+   //! Indexed by platform identifier. Provides the keys of all engagements that platform participates in.
+   using PlatformIndex = std::vector<std::vector<size_t>>;
+
+   //! The identifiers resolved for a batch request. The attack type identifier is
+   //! Interner::cNULL_ID if the attack type is not valid.
+   struct ResolvedRequest
+   {
+      Interner::Id mAttackTypeId;
+      Interner::Id mAttackerId;
+      Interner::Id mVictimId;
+   };
+
+   //! Internal use only - provides the engagement for an analytic evaluation to the evaluation, and
+   //! returns false if the request is not valid. An existing engagement is evaluated in its current
+   //! state. Otherwise, a temporary engagement is evaluated, which is never added to the engagements.
+   bool Evaluate(const std::string&                        aAttackType,
+                 const std::string&                        aAttacker,
+                 const std::string&                        aVictim,
+                 WsfSimulation&                            aSimulation,
+                 const std::function<void(Engagement&)>& aEvaluation);
+
+   //! Internal use only - resolves the identifiers of each batch request.
+   std::vector<ResolvedRequest> ResolveBatch(const std::vector<BatchRequest>& aRequests, WsfSimulation& aSimulation);
+
    //! Internal use only - wrapper for code reuse when searching for a victim or
-   //! attacker by name.
-   EngagementMap::iterator FindEngagementByPlatform(const std::string& aName, bool aByVictim);
+   //! attacker by name. Returns the first engagement found, if any.
+   EngagementData* FindEngagementByPlatform(const std::string& aName, bool aByVictim);
+
+   //! Internal use only - cancels the events of, and removes, every engagement of the platform
+   //! as a victim or as an attacker.
+   void CullEngagements(Interner::Id aPlatformId, bool aByVictim);
+
+   //! Internal use only - removes an engagement, keeping the platform indices synchronized.
+   //! All engagement removal must be done via this method. The engagement data is retained
+   //! for reuse by a subsequent engagement, if possible.
+   void EraseEngagement(size_t aKey);
 
    EngagementData* FindEngagementData(const std::string& aAttackType,
                                       const std::string& aAttacker,
                                       const std::string& aVictim);
+   EngagementData* FindEngagementData(Interner::Id aAttackTypeId, Interner::Id aAttackerId, Interner::Id aVictimId);
    EngagementData* FindEngagementData(size_t aKey);
 
    //! @name Add Engagement method
@@ -161,44 +443,95 @@ protected:
    //! engagements. If an engagement already exists with these parameters,
    //! it is returned instead. Always returns a reference with the found
    //! engagement or the newly created engagement.
-   EngagementData& AddEngagement(const std::string& aAttackType,
-                                 const std::string& aAttacker,
-                                 const std::string& aVictim,
-                                 WsfSimulation&     aSimulation);
-
-   //! @name Scan implementation methods
-   //! CyberScanInitialize() determines if a delay is required due to user input. CyberScan()
-   //! implements the scan phase logic after any possible delay in execution in the previous method call.
-   //! @note Once updated, the scan data exists for the lifetime of the engagement object. If
-   //! any subsequent scans are attempted by the same attacker/victim/attack type combination,
-   //! the completion of that scan will clobber any previous results.
-   //@{
-   void CyberScanInitialize(EngagementData& aEngagementData);
-   void CyberScan(EngagementData& aEngagementData);
-   //@}
+   EngagementData& AddEngagement(Interner::Id   aAttackTypeId,
+                                 Interner::Id   aAttackerId,
+                                 Interner::Id   aVictimId,
+                                 WsfSimulation& aSimulation);
 
-   //! @name Attack implementation methods
-   //! CyberAttackInitialize() processes any delivery delays in the cyber engagement model.
-   //! CyberAttack() picks up with the exploit phase upon completion of the prior phase.
-   //! CyberAttackEffect() is called on a successful attack to employ all associated effects.
-   //! CyberAttackReact() is called upon the completion of the CyberAttackEffect() algorithm to model
-   //! the reaction algorithm of the target.
-   //! @note Once updated, the attack data exists for the lifetime of the engagement object. If
-   //! any subsequent attacks are attempted by the same attacker/victim/attack type combination,
-   //! the completion of that attack will clobber any previous results.
-   //! (We could have something like an WsfCyberEngagementHistory class in the future that could
-   //! log lightweight engagement data for unique attacker/victim/attack type combinations for later recall,
-   //! if this is later determined to be necessary.)
+   //! @name Progression methods
+   //! Process() continues the progression of an engagement in the kernel phase provided, whether
+   //! scheduled or entered without delay, with the phase timed and traced. CyberAttackEffect() is
+   //! called on a successful attack to employ all associated effects.
+   //! @note Once updated, the scan and attack data exist for the lifetime of the engagement object.
+   //! If any subsequent scans or attacks are attempted by the same attacker/victim/attack type
+   //! combination, the completion of that attempt will clobber any previous results.
+   //! The outcome of each attack is retained in the engagement history (see GetHistory()).
    //@{
-   void CyberAttackInitialize(EngagementData& aEngagementData);
-   void CyberAttack(EngagementData& aEngagementData);
+   void Process(kernel::Phase aPhase, EngagementData& aEngagementData);
    void CyberAttackEffect(EngagementData& aEngagementData);
-   void CyberAttackDetectionDelay(EngagementData& aEngagementData);
-   void CyberAttackRecoveryDelay(EngagementData& aEngagementData);
    //@}
 
+   //! Ends the current attack attempt, recording its outcome in the history.
+   void CompleteAttack(Engagement& aEngagement);
+
+   //! Provides the observer callback for the engagement, synchronously and/or asynchronously.
+   void Notify(ObserverRecord::Type aType, Engagement& aEngagement, double aSimTime);
+
+   //! Provides the visualization of the state change, directly or through the coalescing feed.
+   void        Visualize(ObserverRecord::Type aState, Engagement& aEngagement, double aSimTime);
+   static void SendVisualization(ObserverRecord::Type aState, Engagement& aEngagement);
+
+   //! Sends every held visualization state upon completion of the simulation.
+   void CompleteVisualization(double aSimTime);
+
 private:
-   EngagementMap mEngagements;
+   //! The host of the engagement kernel, providing the simulation, effects, scripts and observers.
+   class SimulationHost;
+
+   //! The pools must be declared prior to (and therefore outlive) the engagements using them.
+   EngagementPool mEngagementPool;
+   SlotBlockPool  mEffectPool;
+   EngagementMap  mEngagements;
+
+   //! Secondary indices into mEngagements by victim and attacker, allowing
+   //! for culling without a search of all engagements.
+   PlatformIndex mVictimIndex;
+   PlatformIndex mAttackerIndex;
+
+   Interner mAttackTypeIds;
+   Interner mPlatformIds;
+
+   //! Indexed by attack type identifier.
+   std::vector<std::unique_ptr<AttackTypeInfo>> mAttackTypeInfo;
+
+   //! The results of FindInheritedProtection(), keyed by protect type and attack type identifiers.
+   Interner          mProtectTypeIds;
+   FlatMap<Protect*> mInheritedProtections;
+
+   //! The rows of the threshold table, keyed by protect type definition and attack type identifiers.
+   //! Protect type definitions are identified by name, separately from the protect types of
+   //! FindInheritedProtection(), which are identified by the type of a protect object.
+   Interner       mThresholdProtectTypeIds;
+   ThresholdTable mThresholds;
+
+   bool          mCounterBasedDraws{false};
+   std::uint64_t mDrawSeed{0U};
+
+   EngagementHistory mHistory;
+
+   //! Engagement data removed from use, retained for reuse by new engagements and indexed by
+   //! attack type identifier, such that reuse does not require a new attack object.
+   //! The number of entries retained is limited by cRECYCLE_LIMIT.
+   static constexpr size_t                           cRECYCLE_LIMIT = 1024U;
+   std::vector<std::vector<EngagementPool::Pointer>> mRecycledEngagements;
+   size_t                                            mRecycledCount{0U};
+
+   //! Indexed by platform identifier. The simulation index of the platform last
+   //! associated with the identifier, allowing for platform retrieval without a name lookup.
+   std::vector<size_t> mPlatformIndices;
+
+   Instrumentation              mInstrumentation;
+   std::unique_ptr<TraceWriter> mTraceWriterPtr;
+
+   std::unique_ptr<ObserverDispatcher> mObserverDispatcherPtr;
+   bool                                mSynchronousObservers{true};
+
+   std::unique_ptr<VisualizationFeed> mVisualizationFeedPtr;
+   UtCallbackHolder                   mVisualizationCallbacks;
+
+   //! The state of each engagement in the progression. The host must be declared prior to the kernel.
+   std::unique_ptr<SimulationHost> mHostPtr;
+   kernel::Kernel                  mKernel;
 };
 
 } // namespace cyber
@@ -22,10 +22,10 @@ namespace wsf
 namespace cyber
 {
 
-Event::Event(double aSimTime, Type aEventType, std::string aVictim, size_t aKey)
+Event::Event(double aSimTime, Type aEventType, size_t aVictimId, size_t aKey)
    : WsfEvent(aSimTime)
    , mEventType(aEventType)
-   , mVictim(std::move(aVictim))
+   , mVictimId(aVictimId)
    , mKey(aKey)
 {
 }
@@ -33,59 +33,51 @@ Event::Event(double aSimTime, Type aEventType, std::string aVictim, size_t aKey)
 // =================================================================================================
 Event::EventDisposition Event::Execute()
 {
-   auto& manager = EngagementManager::Get(*GetSimulation());
-
    auto& eventManager = SimulationExtension::Get(*GetSimulation()).GetCyberEventManager();
    auto  attack       = (mEventType != Type::cSCAN_DELAY);
    eventManager.EndEvent(attack, mKey);
 
+   Dispatch(*GetSimulation(), mEventType, mVictimId, mKey);
+
+   // Once this event fires, it is no longer needed. Remove it
+   return EventDisposition::cDELETE;
+}
+
+// =================================================================================================
+void Event::Dispatch(WsfSimulation& aSimulation, Type aEventType, size_t aVictimId, size_t aKey)
+{
+   auto& manager = EngagementManager::Get(aSimulation);
+
    //! Check if the target platform still exists in the simulation, since we've delayed.
-   if (!GetSimulation()->GetPlatformByName(mVictim))
+   if (!manager.GetPlatform(aVictimId, aSimulation))
    {
-      return EventDisposition::cDELETE;
+      return;
    }
 
    //! Do a check for the engagement object to ensure it hasn't been removed since event scheduling
-   if (!manager.EngagementExists(mKey))
+   auto engagementDataPtr = manager.FindEngagementData(aKey);
+   if (!engagementDataPtr)
    {
-      return EventDisposition::cDELETE;
+      return;
    }
 
-   if (mEventType == Type::cSCAN_DELAY)
+   switch (aEventType)
    {
-      auto engagementDataPtr = manager.FindEngagementData(mKey);
-      if (engagementDataPtr)
-      {
-         manager.CyberScan(*engagementDataPtr);
-      }
+   case Type::cSCAN_DELAY:
+      manager.Process(kernel::Phase::cSCAN_DELAY, *engagementDataPtr);
+      break;
+   case Type::cATTACK_DELAY:
+      manager.Process(kernel::Phase::cATTACK_DELAY, *engagementDataPtr);
+      break;
+   case Type::cATTACK_DETECTION_DELAY:
+      manager.Process(kernel::Phase::cATTACK_DETECTION_DELAY, *engagementDataPtr);
+      break;
+   case Type::cATTACK_RECOVERY_DELAY:
+      manager.Process(kernel::Phase::cATTACK_RECOVERY_DELAY, *engagementDataPtr);
+      break;
+   default:
+      break;
    }
-   else if (mEventType == Type::cATTACK_DELAY)
-   {
-      auto engagementDataPtr = manager.FindEngagementData(mKey);
-      if (engagementDataPtr)
-      {
-         manager.CyberAttack(*engagementDataPtr);
-      }
-   }
-   else if (mEventType == Type::cATTACK_DETECTION_DELAY)
-   {
-      auto engagementDataPtr = manager.FindEngagementData(mKey);
-      if (engagementDataPtr)
-      {
-         manager.CyberAttackDetectionDelay(*engagementDataPtr);
-      }
-   }
-   else if (mEventType == Type::cATTACK_RECOVERY_DELAY)
-   {
-      auto engagementDataPtr = manager.FindEngagementData(mKey);
-      if (engagementDataPtr)
-      {
-         manager.CyberAttackRecoveryDelay(*engagementDataPtr);
-      }
-   }
-
-   // Once this event fires, it is no longer needed. Remove it
-   return EventDisposition::cDELETE;
 }
 
 } // namespace cyber
@@ -14,9 +14,8 @@
 
 #include "wsf_cyber_export.h"
 
-#include <string>
-
 #include "WsfEvent.hpp"
+class WsfSimulation;
 
 namespace wsf
 {
@@ -39,20 +38,26 @@ public:
       cNONE
    };
 
-   Event(double aSimTime, Type aEventType, std::string aVictim, size_t aKey);
+   //! The victim identifier is the platform identifier provided by the engagement manager.
+   Event(double aSimTime, Type aEventType, size_t aVictimId, size_t aKey);
 
    ~Event() override = default;
 
    EventDisposition Execute() override;
 
-   Type               GetType() const { return mEventType; }
-   const std::string& GetVictim() const { return mVictim; }
-   size_t             GetKey() const { return mKey; }
+   //! Progresses the engagement through the delay of the provided type that has just elapsed, if
+   //! the victim and engagement still exist. This is used both by the event itself and by the
+   //! event manager for delays held in its timing wheel.
+   static void Dispatch(WsfSimulation& aSimulation, Type aEventType, size_t aVictimId, size_t aKey);
+
+   Type   GetType() const { return mEventType; }
+   size_t GetVictimId() const { return mVictimId; }
+   size_t GetKey() const { return mKey; }
 
 private:
-   Type        mEventType;
-   std::string mVictim;
-   size_t      mKey;
+   Type   mEventType;
+   size_t mVictimId;
+   size_t mKey;
 };
 
 } // namespace cyber
@@ -12,8 +12,13 @@
 #include "WsfCyberEventManager.hpp"
 
 #include <algorithm>
+#include <limits>
 
+#include "UtException.hpp"
+#include "UtMemory.hpp"
+#include "WsfCyberEngagementManager.hpp"
 #include "WsfCyberEvent.hpp"
+#include "WsfCyberInstrumentation.hpp"
 #include "WsfCyberSimulationExtension.hpp"
 #include "WsfEvent.hpp"
 #include "WsfSimulation.hpp"
@@ -24,10 +29,80 @@ namespace wsf
 namespace cyber
 {
 
+//! The simulation event scheduled at the earliest delay held in the timing wheel.
+class EventManager::DelayEvent : public WsfEvent
+{
+public:
+   explicit DelayEvent(double aSimTime)
+      : WsfEvent(aSimTime)
+   {
+   }
+
+   //! The event is rescheduled at the next pending delay, rather than replaced by another event.
+   EventDisposition Execute() override
+   {
+      auto nextTime = SimulationExtension::Get(*GetSimulation()).GetCyberEventManager().DispatchDelays(GetTime());
+      if (nextTime == std::numeric_limits<double>::max())
+      {
+         return EventDisposition::cDELETE;
+      }
+      SetTime(nextTime);
+      return EventDisposition::cRESCHEDULE;
+   }
+};
+
+namespace
+{
+//! The host of the event manager of a simulation.
+class SimulationHost : public EventManager::Host
+{
+public:
+   explicit SimulationHost(WsfSimulation& aSimulation)
+      : mSimulation(aSimulation)
+   {
+   }
+
+   void AddEvent(std::unique_ptr<WsfEvent> aEventPtr) override { mSimulation.AddEvent(std::move(aEventPtr)); }
+
+   void Dispatch(Event::Type aEventType, size_t aVictimId, size_t aKey) override
+   {
+      Event::Dispatch(mSimulation, aEventType, aVictimId, aKey);
+   }
+
+   void Cancel(size_t aKey) override
+   {
+      SimulationExtension::Get(mSimulation).GetCyberEngagementManager().Cancel(aKey);
+   }
+
+   void SetEventCount(size_t aEventCount) override
+   {
+      SimulationExtension::Get(mSimulation).GetCyberEngagementManager().GetInstrumentation().SetEventCount(
+         aEventCount);
+   }
+
+private:
+   WsfSimulation& mSimulation;
+};
+} // namespace
+
+constexpr size_t EventManager::cCOMPACTION_CAPACITY;
+
 // =================================================================================================
 EventManager::EventManager(WsfSimulation& aSimulation)
-   : mSimulation(aSimulation)
+   : mHostPtr(ut::make_unique<SimulationHost>(aSimulation))
+   , mTimingWheelPtr(ut::make_unique<TimingWheel>())
+{
+}
+
+// =================================================================================================
+EventManager::EventManager(std::unique_ptr<Host> aHostPtr)
+   : mHostPtr(std::move(aHostPtr))
+   , mTimingWheelPtr(ut::make_unique<TimingWheel>())
 {
+   if (!mHostPtr)
+   {
+      throw UtException("Attempting to create a cyber event manager without a host.");
+   }
 }
 
 // =================================================================================================
@@ -40,8 +115,55 @@ void EventManager::AddEvent(std::unique_ptr<Event> aEventPtr)
 
    bool     attackType = (aEventPtr->GetType() != Event::Type::cSCAN_DELAY);
    EventKey key(attackType, aEventPtr->GetKey());
-   mEventMap.emplace(key, aEventPtr.get());
-   mSimulation.AddEvent(std::move(aEventPtr));
+   Entry    entry{aEventPtr.get(), TimingWheel::cNO_HANDLE, aEventPtr->GetType(), aEventPtr->GetVictimId()};
+   EmplaceEntry(key, entry);
+   mHostPtr->AddEvent(std::move(aEventPtr));
+   WSF_CYBER_INSTRUMENT(UpdateEventCount());
+}
+
+// =================================================================================================
+void EventManager::AddDelay(double aSimTime, Event::Type aEventType, size_t aVictimId, size_t aKey)
+{
+   if (!mTimingWheelPtr)
+   {
+      AddEvent(ut::make_unique<Event>(aSimTime, aEventType, aVictimId, aKey));
+      return;
+   }
+
+   auto     handle = mTimingWheelPtr->Insert(aSimTime, static_cast<std::uint8_t>(aEventType), aVictimId, aKey);
+   EventKey key((aEventType != Event::Type::cSCAN_DELAY), aKey);
+   EmplaceEntry(key, Entry{nullptr, handle, aEventType, aVictimId});
+   ScheduleDelayEvent(aSimTime);
+   WSF_CYBER_INSTRUMENT(UpdateEventCount());
+}
+
+// =================================================================================================
+void EventManager::EnableTimingWheel(double aTickSize /* = TimingWheel::cDEFAULT_TICK_SIZE */)
+{
+   if (mTimingWheelPtr && (mTimingWheelPtr->GetTickSize() == aTickSize))
+   {
+      return;
+   }
+   if (mTimingWheelPtr && !mTimingWheelPtr->IsEmpty())
+   {
+      throw UtException("Unable to change the cyber timing wheel tick size while delays are pending.");
+   }
+   mTimingWheelPtr = ut::make_unique<TimingWheel>(aTickSize);
+}
+
+// =================================================================================================
+void EventManager::DisableTimingWheel()
+{
+   if (mTimingWheelPtr && !mTimingWheelPtr->IsEmpty())
+   {
+      throw UtException("Unable to disable the cyber timing wheel while delays are pending.");
+   }
+   if (mDelayEventPtr)
+   {
+      mDelayEventPtr->SetShouldExecute(false);
+      mDelayEventPtr = nullptr;
+   }
+   mTimingWheelPtr.reset();
 }
 
 // =================================================================================================
@@ -52,7 +174,8 @@ void EventManager::EndEvent(bool aAttack, size_t aEngagementKey)
 
    if (it != std::end(mEventMap))
    {
-      mEventMap.erase(it);
+      EraseEntry(it);
+      WSF_CYBER_INSTRUMENT(UpdateEventCount());
    }
 }
 
@@ -64,15 +187,47 @@ bool EventManager::CancelEvent(bool aAttack, size_t aEngagementKey)
 
    if (it != std::end(mEventMap))
    {
-      it->second->SetShouldExecute(false);
-      SimulationExtension::Get(mSimulation).GetCyberEngagementManager().Cancel(aEngagementKey);
-      mEventMap.erase(it);
+      if (it->second.mEventPtr)
+      {
+         it->second.mEventPtr->SetShouldExecute(false);
+      }
+      else
+      {
+         mTimingWheelPtr->Cancel(it->second.mHandle);
+      }
+      mHostPtr->Cancel(aEngagementKey);
+      EraseEntry(it);
+      WSF_CYBER_INSTRUMENT(UpdateEventCount());
+      CompactTimingWheel();
       return true;
    }
 
    return false;
 }
 
+// =================================================================================================
+size_t EventManager::CancelEvents(size_t aVictimId)
+{
+   if (aVictimId >= mVictimIndex.size())
+   {
+      return 0U;
+   }
+
+   // The keys are taken from the index, such that each cancellation need not search for its key.
+   std::vector<EventKey> keys;
+   keys.swap(mVictimIndex[aVictimId]);
+
+   size_t canceled = 0U;
+   for (const auto& key : keys)
+   {
+      if (CancelEvent(key.mAttack, key.mEngagementKey))
+      {
+         ++canceled;
+      }
+   }
+   return canceled;
+}
+
 // =================================================================================================
 bool EventManager::EventExists(bool aAttack, size_t aEngagementKey) const
 {
@@ -93,7 +248,135 @@ Event::Type EventManager::GetEventType(bool aAttack, size_t aEngagementKey) cons
       return Event::Type::cNONE;
    }
 
-   return it->second->GetType();
+   return it->second.mEventType;
+}
+
+// =================================================================================================
+double EventManager::DispatchDelays(double aSimTime)
+{
+   // The executing delay event remains the scheduled delay event while dispatching, such that a delay
+   // added by a dispatched engagement does not schedule another event.
+   mDelayEventTime = aSimTime;
+   mDispatching    = true;
+   mTimingWheelPtr->PopDue(aSimTime, mDueRecords);
+   for (const auto& record : mDueRecords)
+   {
+      // Skip delays canceled while dispatching the delays preceding them.
+      auto     eventType = static_cast<Event::Type>(record.mType);
+      EventKey key((eventType != Event::Type::cSCAN_DELAY), record.mKey);
+      auto     it = mEventMap.find(key);
+      if ((it == std::end(mEventMap)) || it->second.mEventPtr || (it->second.mHandle != record.mHandle))
+      {
+         continue;
+      }
+
+      EraseEntry(it);
+      WSF_CYBER_INSTRUMENT(UpdateEventCount());
+      mHostPtr->Dispatch(eventType, record.mVictimId, record.mKey);
+   }
+   mDueRecords.clear();
+   mDispatching = false;
+
+   // The delay event is released if the wheel was disabled by a dispatched engagement.
+   if (!mTimingWheelPtr || !mDelayEventPtr)
+   {
+      return std::numeric_limits<double>::max();
+   }
+
+   CompactTimingWheel();
+   auto nextTime = mTimingWheelPtr->GetNextTime();
+   if (nextTime == std::numeric_limits<double>::max())
+   {
+      mDelayEventPtr = nullptr;
+   }
+   mDelayEventTime = nextTime;
+   return nextTime;
+}
+
+// =================================================================================================
+void EventManager::ScheduleDelayEvent(double aSimTime)
+{
+   if (aSimTime == std::numeric_limits<double>::max())
+   {
+      return;
+   }
+
+   if (mDelayEventPtr)
+   {
+      if (mDelayEventTime <= aSimTime)
+      {
+         return;
+      }
+      // The earlier delay supersedes the scheduled event, which is then discarded by the simulation.
+      mDelayEventPtr->SetShouldExecute(false);
+   }
+
+   auto eventPtr   = ut::make_unique<DelayEvent>(aSimTime);
+   mDelayEventPtr  = eventPtr.get();
+   mDelayEventTime = aSimTime;
+   mHostPtr->AddEvent(std::move(eventPtr));
+}
+
+// =================================================================================================
+void EventManager::CompactTimingWheel()
+{
+   // The due records of a dispatch in progress refer to the handles prior to compaction.
+   if (!mTimingWheelPtr || mDispatching || (mTimingWheelPtr->GetCapacity() < cCOMPACTION_CAPACITY) ||
+       (mTimingWheelPtr->GetSize() >= mTimingWheelPtr->GetCapacity() / 4U))
+   {
+      return;
+   }
+
+   mTimingWheelPtr->Compact(
+      [this](const TimingWheel::Record& aRecord, TimingWheel::Handle aPreviousHandle)
+      {
+         auto     eventType = static_cast<Event::Type>(aRecord.mType);
+         EventKey key((eventType != Event::Type::cSCAN_DELAY), aRecord.mKey);
+         auto     it = mEventMap.find(key);
+         if ((it != std::end(mEventMap)) && (it->second.mHandle == aPreviousHandle))
+         {
+            it->second.mHandle = aRecord.mHandle;
+         }
+      });
+}
+
+// =================================================================================================
+void EventManager::EmplaceEntry(const EventKey& aKey, const Entry& aEntry)
+{
+   if (!mEventMap.emplace(aKey, aEntry).second)
+   {
+      return;
+   }
+
+   if (mVictimIndex.size() <= aEntry.mVictimId)
+   {
+      mVictimIndex.resize(aEntry.mVictimId + 1U);
+   }
+   mVictimIndex[aEntry.mVictimId].push_back(aKey);
+}
+
+// =================================================================================================
+void EventManager::EraseEntry(EventMap::iterator aIt)
+{
+   auto victimId = aIt->second.mVictimId;
+   if (victimId < mVictimIndex.size())
+   {
+      auto& keys   = mVictimIndex[victimId];
+      auto  keyPos = std::find(std::begin(keys), std::end(keys), aIt->first);
+      if (keyPos != std::end(keys))
+      {
+         // Order is irrelevant, so avoid shifting the remaining entries.
+         *keyPos = keys.back();
+         keys.pop_back();
+      }
+   }
+   mEventMap.erase(aIt);
+}
+
+// =================================================================================================
+void EventManager::UpdateEventCount()
+{
+   mHostPtr->SetEventCount(mEventMap.size());
 }
 
 } // namespace cyber
@@ -16,8 +16,10 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "WsfCyberEvent.hpp"
+#include "WsfCyberTimingWheel.hpp"
 class WsfSimulation;
 
 namespace wsf
@@ -38,10 +40,43 @@ namespace cyber
 //! given time for this use case for scans or attacks.
 //! Other events, such as those that might be used
 //! by effects directly, are not handled nor intended to be handled by this object.
+//!
+//! By default, delays are held as compact records in a cyber timing wheel, and a
+//! single simulation event is scheduled at the earliest pending delay to dispatch
+//! every delay due at that time. This keeps the simulation event queue small when
+//! many engagements are in progress. When the timing wheel is disabled, each delay
+//! is instead a distinct simulation event.
+//!
+//! Canceling an event only prevents its execution, leaving it in the simulation
+//! event queue until its time. Canceling a delay held in the timing wheel removes
+//! it, and the wheel is compacted when mass cancellation leaves most of it unused.
 class WSF_CYBER_EXPORT EventManager final
 {
 public:
+   //! The interface through which events are scheduled, and through which the engagements
+   //! of dispatched and canceled events are progressed or released. Within a simulation,
+   //! this is provided by the simulation and its engagement manager. Otherwise (e.g. for
+   //! benchmarking), a standalone host may provide its own event queue.
+   class WSF_CYBER_EXPORT Host
+   {
+   public:
+      virtual ~Host() = default;
+
+      //! Schedules the event, which is then executed at its time.
+      virtual void AddEvent(std::unique_ptr<WsfEvent> aEventPtr) = 0;
+
+      //! Progresses the engagement through a delay held in the timing wheel that has elapsed.
+      virtual void Dispatch(Event::Type aEventType, size_t aVictimId, size_t aKey) = 0;
+
+      //! Releases the engagement of a canceled event.
+      virtual void Cancel(size_t aKey) = 0;
+
+      //! Provides the number of managed events, for instrumentation.
+      virtual void SetEventCount(size_t aEventCount) {}
+   };
+
    EventManager(WsfSimulation& aSimulation);
+   explicit EventManager(std::unique_ptr<Host> aHostPtr);
    ~EventManager()                        = default;
    EventManager(const EventManager& aSrc) = delete;
    EventManager& operator=(const EventManager& aRhs) = delete;
@@ -53,6 +88,22 @@ public:
    //! conduct tracking of the event for usage within the cyber library.
    void AddEvent(std::unique_ptr<Event> aEventPtr);
 
+   //! Add a delay for an engagement.
+   //! The delay is held in the timing wheel if it is enabled. Otherwise, an event
+   //! is created and added as in AddEvent.
+   void AddDelay(double aSimTime, Event::Type aEventType, size_t aVictimId, size_t aKey);
+
+   //! @name Timing wheel methods
+   //! The timing wheel is enabled with the default tick size on construction. Enabling or
+   //! disabling the wheel affects subsequent delays only, and delays that have already been
+   //! scheduled as events are unaffected.
+   //! @note The tick size may not be changed, nor the wheel disabled, while delays are held in the wheel.
+   //@{
+   void EnableTimingWheel(double aTickSize = TimingWheel::cDEFAULT_TICK_SIZE);
+   void DisableTimingWheel();
+   bool IsTimingWheelEnabled() const { return (mTimingWheelPtr != nullptr); }
+   //@}
+
    //! End an event.
    //! The EndEvent method only removes the event from management by the
    //! cyber event manager. This call is intended to be called only by
@@ -66,6 +117,13 @@ public:
    //! this manner is immediately available for reuse.
    bool CancelEvent(bool aAttack, size_t aEngagementKey);
 
+   //! Cancel the events of every engagement against a victim.
+   //! This is intended for mass cancellation, such as upon the removal of the victim.
+   //! The events are found via an index by victim, such that the cost is proportional
+   //! to the number of events of the victim rather than of all managed events.
+   //! Returns the number of events canceled.
+   size_t CancelEvents(size_t aVictimId);
+
    //! EventExists
    //! Query for the existence of a managed event.
    bool EventExists(bool aAttack, size_t aEngagementKey) const;
@@ -73,6 +131,14 @@ public:
    //! Retrieve the type of the event.
    Event::Type GetEventType(bool aAttack, size_t aEngagementKey) const;
 
+   //! Returns the number of events currently managed.
+   size_t GetEventCount() const { return mEventMap.size(); }
+
+   //! Dispatches the delays in the timing wheel that are due. This is invoked by the delay event
+   //! when executed by the host. Returns the time of the next pending delay, at which the delay
+   //! event is to be rescheduled, or std::numeric_limits<double>::max() if none remain.
+   double DispatchDelays(double aSimTime);
+
 private:
    struct EventKey
    {
@@ -101,10 +167,50 @@ private:
       }
    };
 
-   using EventMap = std::unordered_map<EventKey, Event*, EventKeyHash>;
+   //! A managed delay, either a scheduled event or a record in the timing wheel.
+   struct Entry
+   {
+      Event*              mEventPtr;
+      TimingWheel::Handle mHandle;
+      Event::Type         mEventType;
+      size_t              mVictimId;
+   };
+
+   //! The minimum capacity of the timing wheel for it to be compacted.
+   static constexpr size_t cCOMPACTION_CAPACITY = 4096U;
+
+   using EventMap = std::unordered_map<EventKey, Entry, EventKeyHash>;
+
+   //! Indexed by victim identifier. Provides the keys of the managed events of the victim.
+   using VictimIndex = std::vector<std::vector<EventKey>>;
+
+   //! The simulation event that dispatches the delays held in the timing wheel.
+   class DelayEvent;
+
+   //! Ensures a delay event is scheduled no later than the provided time.
+   void ScheduleDelayEvent(double aSimTime);
+
+   //! Compacts the timing wheel if less than a quarter of its capacity is in use.
+   void CompactTimingWheel();
+
+   //! Adds or removes a managed event, maintaining the victim index.
+   //! An event already managed for the engagement is retained in preference to the new event.
+   //@{
+   void EmplaceEntry(const EventKey& aKey, const Entry& aEntry);
+   void EraseEntry(EventMap::iterator aIt);
+   //@}
+
+   //! Provides the number of managed events to the engagement manager instrumentation.
+   void UpdateEventCount();
 
-   WsfSimulation& mSimulation;
-   EventMap       mEventMap{};
+   std::unique_ptr<Host>            mHostPtr;
+   EventMap                         mEventMap{};
+   VictimIndex                      mVictimIndex{};
+   std::unique_ptr<TimingWheel>     mTimingWheelPtr{nullptr};
+   std::vector<TimingWheel::Record> mDueRecords{};
+   DelayEvent*                      mDelayEventPtr{nullptr};
+   double                           mDelayEventTime{0.0};
+   bool                             mDispatching{false};
 };
 
 } // namespace cyber
@@ -0,0 +1,236 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFCYBERFLATMAP_HPP
+#define WSFCYBERFLATMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! An open addressing hash map keyed by an unsigned 64 bit integer, using linear probing
+//! and backward shift deletion. Entries are stored contiguously, such that lookups require
+//! no node traversal and insertions require no allocation beyond periodic growth of the table.
+//! @note Values are moved when the table grows or entries are removed. Any value that requires
+//! a stable address must be held indirectly (e.g. via a pointer).
+template<class T>
+class FlatMap
+{
+public:
+   using Key = std::uint64_t;
+
+   FlatMap()                    = default;
+   ~FlatMap()                   = default;
+   FlatMap(const FlatMap& aSrc) = delete;
+   FlatMap& operator=(const FlatMap& aRhs) = delete;
+   FlatMap(FlatMap&& aSrc)                 = default;
+   FlatMap& operator=(FlatMap&& aRhs) = default;
+
+   //! Returns a pointer to the value associated with the key, or nullptr if not present.
+   T* Find(Key aKey)
+   {
+      auto index = FindIndex(aKey);
+      return (index != cNOT_FOUND) ? &mSlots[index].mValue : nullptr;
+   }
+
+   const T* Find(Key aKey) const
+   {
+      auto index = FindIndex(aKey);
+      return (index != cNOT_FOUND) ? &mSlots[index].mValue : nullptr;
+   }
+
+   bool Contains(Key aKey) const { return (FindIndex(aKey) != cNOT_FOUND); }
+
+   //! Inserts the value if the key is not already present.
+   //! Returns the value associated with the key, and true if an insertion occurred.
+   std::pair<T*, bool> Emplace(Key aKey, T aValue)
+   {
+      if ((mSize + 1U) * cLOAD_DENOMINATOR > mSlots.size() * cLOAD_NUMERATOR)
+      {
+         Rehash(mSlots.empty() ? cMIN_CAPACITY : (mSlots.size() * 2U));
+      }
+
+      auto index = HomeIndex(aKey);
+      while (mSlots[index].mOccupied)
+      {
+         if (mSlots[index].mKey == aKey)
+         {
+            return std::make_pair(&mSlots[index].mValue, false);
+         }
+         index = (index + 1U) & mMask;
+      }
+
+      auto& slot     = mSlots[index];
+      slot.mKey      = aKey;
+      slot.mValue    = std::move(aValue);
+      slot.mOccupied = true;
+      ++mSize;
+      return std::make_pair(&slot.mValue, true);
+   }
+
+   //! Removes the entry associated with the key. Returns true if an entry was removed.
+   bool Erase(Key aKey)
+   {
+      auto index = FindIndex(aKey);
+      if (index == cNOT_FOUND)
+      {
+         return false;
+      }
+
+      //! Shift any subsequent entries in the probe sequence back into the vacated slot,
+      //! such that no tombstones are required.
+      auto next = index;
+      while (true)
+      {
+         next = (next + 1U) & mMask;
+         if (!mSlots[next].mOccupied)
+         {
+            break;
+         }
+
+         auto home = HomeIndex(mSlots[next].mKey);
+         bool stay = (index <= next) ? ((index < home) && (home <= next)) : ((index < home) || (home <= next));
+         if (!stay)
+         {
+            mSlots[index].mKey   = mSlots[next].mKey;
+            mSlots[index].mValue = std::move(mSlots[next].mValue);
+            index                = next;
+         }
+      }
+
+      mSlots[index].mValue    = T{};
+      mSlots[index].mOccupied = false;
+      --mSize;
+      return true;
+   }
+
+   //! Ensures the table can hold the provided number of entries without growth.
+   void Reserve(size_t aCount)
+   {
+      size_t capacity = cMIN_CAPACITY;
+      while (aCount * cLOAD_DENOMINATOR > capacity * cLOAD_NUMERATOR)
+      {
+         capacity *= 2U;
+      }
+
+      if (capacity > mSlots.size())
+      {
+         Rehash(capacity);
+      }
+   }
+
+   void Clear()
+   {
+      mSlots.clear();
+      mMask = 0U;
+      mSize = 0U;
+   }
+
+   size_t GetSize() const { return mSize; }
+   bool   IsEmpty() const { return (mSize == 0U); }
+
+   //! Invokes the provided function with the key and value of each entry.
+   //! The map must not be modified during iteration.
+   template<class FUNC>
+   void ForEach(FUNC aFunc)
+   {
+      for (auto& slot : mSlots)
+      {
+         if (slot.mOccupied)
+         {
+            aFunc(slot.mKey, slot.mValue);
+         }
+      }
+   }
+
+private:
+   static constexpr size_t cNOT_FOUND        = static_cast<size_t>(-1);
+   static constexpr size_t cMIN_CAPACITY     = 16U;
+   static constexpr size_t cLOAD_NUMERATOR   = 3U;
+   static constexpr size_t cLOAD_DENOMINATOR = 4U;
+
+   struct Slot
+   {
+      Key  mKey{0U};
+      bool mOccupied{false};
+      T    mValue{};
+   };
+
+   size_t HomeIndex(Key aKey) const
+   {
+      // Finalizer from the SplitMix64 generator, as the keys are frequently
+      // composed of small, dense values.
+      aKey ^= (aKey >> 30);
+      aKey *= 0xbf58476d1ce4e5b9ULL;
+      aKey ^= (aKey >> 27);
+      aKey *= 0x94d049bb133111ebULL;
+      aKey ^= (aKey >> 31);
+      return static_cast<size_t>(aKey) & mMask;
+   }
+
+   size_t FindIndex(Key aKey) const
+   {
+      if (mSize == 0U)
+      {
+         return cNOT_FOUND;
+      }
+
+      auto index = HomeIndex(aKey);
+      while (mSlots[index].mOccupied)
+      {
+         if (mSlots[index].mKey == aKey)
+         {
+            return index;
+         }
+         index = (index + 1U) & mMask;
+      }
+      return cNOT_FOUND;
+   }
+
+   void Rehash(size_t aCapacity)
+   {
+      std::vector<Slot> oldSlots(aCapacity);
+      oldSlots.swap(mSlots);
+      mMask = aCapacity - 1U;
+      mSize = 0U;
+
+      for (auto& slot : oldSlots)
+      {
+         if (slot.mOccupied)
+         {
+            auto index = HomeIndex(slot.mKey);
+            while (mSlots[index].mOccupied)
+            {
+               index = (index + 1U) & mMask;
+            }
+            mSlots[index].mKey      = slot.mKey;
+            mSlots[index].mValue    = std::move(slot.mValue);
+            mSlots[index].mOccupied = true;
+            ++mSize;
+         }
+      }
+   }
+
+   std::vector<Slot> mSlots{};
+   size_t            mMask{0U};
+   size_t            mSize{0U};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
@@ -0,0 +1,135 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberInstrumentation.hpp"
+
+#include <algorithm>
+
+#include "UtLog.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+// =================================================================================================
+const char* Instrumentation::GetPhaseName(Phase aPhase)
+{
+   switch (aPhase)
+   {
+   case cSCAN:
+      return "scan";
+   case cDELIVERY:
+      return "delivery";
+   case cEXPLOIT:
+      return "exploit";
+   case cEFFECT:
+      return "effect";
+   case cDETECTION:
+      return "detection";
+   case cRECOVERY:
+      return "recovery";
+   default:
+      return "unknown";
+   }
+}
+
+// =================================================================================================
+void Instrumentation::AddPhase(Phase aPhase, double aWallTime)
+{
+   auto& phase = mPhases[aPhase];
+   ++phase.mCount;
+   phase.mWallTime += aWallTime;
+}
+
+// =================================================================================================
+void Instrumentation::AddAttackFailure(Engagement::CyberAttackFailure aReason)
+{
+   if (aReason != Engagement::cATTACK_NONE)
+   {
+      ++mAttackFailures[aReason];
+   }
+}
+
+// =================================================================================================
+void Instrumentation::AddScanFailure(Engagement::CyberScanFailure aReason)
+{
+   if (aReason != Engagement::cSCAN_NONE)
+   {
+      ++mScanFailures[aReason];
+   }
+}
+
+// =================================================================================================
+void Instrumentation::SetEventCount(size_t aEventCount)
+{
+   mEventCount    = aEventCount;
+   mMaxEventCount = std::max(mMaxEventCount, aEventCount);
+}
+
+// =================================================================================================
+void Instrumentation::SetReportInterval(double aReportInterval)
+{
+   mReportInterval = std::max(aReportInterval, 0.0);
+   mNextReportTime = mReportInterval;
+}
+
+// =================================================================================================
+void Instrumentation::ReportIfDue(double aSimTime)
+{
+   if ((mReportInterval > 0.0) && (aSimTime >= mNextReportTime))
+   {
+      Report(aSimTime);
+
+      //! Intervals without activity are not reported.
+      while (mNextReportTime <= aSimTime)
+      {
+         mNextReportTime += mReportInterval;
+      }
+   }
+}
+
+// =================================================================================================
+void Instrumentation::Report(double aSimTime) const
+{
+   auto out = ut::log::info() << "Cyber engagement instrumentation:";
+   out.AddNote() << "T = " << aSimTime;
+   for (size_t phase = 0U; phase < cPHASE_COUNT; ++phase)
+   {
+      const auto& statistics = mPhases[phase];
+      out.AddNote() << "Phase " << GetPhaseName(static_cast<Phase>(phase)) << ": " << statistics.mCount
+                    << " handled in " << statistics.mWallTime << " s";
+   }
+
+   out.AddNote() << "Attack failures: random draw " << mAttackFailures[Engagement::cATTACK_RANDOM_DRAW]
+                 << ", immunity " << mAttackFailures[Engagement::cATTACK_IMMUNITY] << ", not vulnerable "
+                 << mAttackFailures[Engagement::cATTACK_NOT_VULNERABLE] << ", insufficient resources "
+                 << mAttackFailures[Engagement::cATTACK_INSUFFICIENT_RESOURCES];
+   out.AddNote() << "Scan failures: immunity " << mScanFailures[Engagement::cSCAN_IMMUNITY] << ", detected "
+                 << mScanFailures[Engagement::cSCAN_DETECTED] << ", not vulnerable "
+                 << mScanFailures[Engagement::cSCAN_NOT_VULNERABLE];
+   out.AddNote() << "Pending events: " << mEventCount << " (maximum " << mMaxEventCount << ")";
+}
+
+// =================================================================================================
+void Instrumentation::Reset()
+{
+   mPhases.fill(PhaseStatistics{});
+   mAttackFailures.fill(0U);
+   mScanFailures.fill(0U);
+   //! Pending events remain pending.
+   mMaxEventCount  = mEventCount;
+   mNextReportTime = mReportInterval;
+}
+
+} // namespace cyber
+} // namespace wsf
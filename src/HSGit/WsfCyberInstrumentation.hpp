@@ -0,0 +1,138 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERINSTRUMENTATION_HPP
+#define WSFCYBERINSTRUMENTATION_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "WsfCyberEngagement.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! Counters and wall clock timers for the phases of the engagement progression, along with the
+//! outcomes of failed scans and attacks and the number of pending cyber events.
+//!
+//! Instrumentation is enabled at compile time by defining WSF_CYBER_INSTRUMENTATION. Otherwise,
+//! the instrumentation macros below expand to nothing, and every query returns zero. The layout
+//! of this class does not depend upon the definition, so that libraries built with and without
+//! instrumentation remain compatible.
+class WSF_CYBER_EXPORT Instrumentation
+{
+public:
+   enum Phase : size_t
+   {
+      cSCAN,
+      cDELIVERY,
+      cEXPLOIT,
+      cEFFECT,
+      cDETECTION,
+      cRECOVERY,
+      cPHASE_COUNT
+   };
+
+   struct PhaseStatistics
+   {
+      size_t mCount{0U};
+      double mWallTime{0.0};
+   };
+
+   //! Times a phase handler for the duration of its scope.
+   //! @note The time of a phase includes the time of any phase handled within it.
+   class ScopedTimer
+   {
+   public:
+      ScopedTimer(Instrumentation& aInstrumentation, Phase aPhase)
+         : mInstrumentation(aInstrumentation)
+         , mPhase(aPhase)
+         , mStart(std::chrono::steady_clock::now())
+      {
+      }
+
+      ~ScopedTimer()
+      {
+         mInstrumentation.AddPhase(mPhase,
+                                   std::chrono::duration<double>(std::chrono::steady_clock::now() - mStart).count());
+      }
+
+      ScopedTimer(const ScopedTimer& aSrc) = delete;
+      ScopedTimer& operator=(const ScopedTimer& aRhs) = delete;
+
+   private:
+      Instrumentation&                      mInstrumentation;
+      Phase                                 mPhase;
+      std::chrono::steady_clock::time_point mStart;
+   };
+
+   static const char* GetPhaseName(Phase aPhase);
+
+   //! @name Recording methods
+   //! Failure reasons of cATTACK_NONE and cSCAN_NONE are ignored.
+   //@{
+   void AddPhase(Phase aPhase, double aWallTime);
+   void AddAttackFailure(Engagement::CyberAttackFailure aReason);
+   void AddScanFailure(Engagement::CyberScanFailure aReason);
+   void SetEventCount(size_t aEventCount);
+   //@}
+
+   //! @name Query methods
+   //@{
+   const PhaseStatistics& GetPhase(Phase aPhase) const { return mPhases[aPhase]; }
+   size_t GetAttackFailures(Engagement::CyberAttackFailure aReason) const { return mAttackFailures[aReason]; }
+   size_t GetScanFailures(Engagement::CyberScanFailure aReason) const { return mScanFailures[aReason]; }
+   size_t GetEventCount() const { return mEventCount; }
+   size_t GetMaxEventCount() const { return mMaxEventCount; }
+   //@}
+
+   //! @name Reporting methods
+   //! A report is written to the log each time the report interval (in simulation time) elapses,
+   //! as checked by ReportIfDue(). An interval of zero (the default) disables periodic reports.
+   //@{
+   void   SetReportInterval(double aReportInterval);
+   double GetReportInterval() const { return mReportInterval; }
+   void   ReportIfDue(double aSimTime);
+   void   Report(double aSimTime) const;
+   //@}
+
+   void Reset();
+
+private:
+   std::array<PhaseStatistics, cPHASE_COUNT>          mPhases{};
+   std::array<size_t, Engagement::cATTACK_NONE + 1U> mAttackFailures{};
+   std::array<size_t, Engagement::cSCAN_NONE + 1U>   mScanFailures{};
+
+   size_t mEventCount{0U};
+   size_t mMaxEventCount{0U};
+   double mReportInterval{0.0};
+   double mNextReportTime{0.0};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#ifdef WSF_CYBER_INSTRUMENTATION
+#define WSF_CYBER_INSTRUMENT_PHASE(INSTRUMENTATION, PHASE) \
+   wsf::cyber::Instrumentation::ScopedTimer wsfCyberPhaseTimer((INSTRUMENTATION), (PHASE))
+#define WSF_CYBER_INSTRUMENT(STATEMENT) STATEMENT
+#else
+#define WSF_CYBER_INSTRUMENT_PHASE(INSTRUMENTATION, PHASE)
+#define WSF_CYBER_INSTRUMENT(STATEMENT)
+#endif
+
+#endif
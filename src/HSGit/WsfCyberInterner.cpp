@@ -0,0 +1,46 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfCyberInterner.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+constexpr Interner::Id Interner::cNULL_ID;
+
+// =================================================================================================
+Interner::Id Interner::Intern(const std::string& aName)
+{
+   auto result = mIds.emplace(aName, mNames.size());
+   if (result.second)
+   {
+      mNames.push_back(&result.first->first);
+   }
+
+   return result.first->second;
+}
+
+// =================================================================================================
+Interner::Id Interner::Find(const std::string& aName) const
+{
+   auto it = mIds.find(aName);
+   if (it != std::end(mIds))
+   {
+      return it->second;
+   }
+
+   return cNULL_ID;
+}
+
+} // namespace cyber
+} // namespace wsf
@@ -0,0 +1,71 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFCYBERINTERNER_HPP
+#define WSFCYBERINTERNER_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! A simple string interner that provides dense, zero based integer identifiers.
+//! Identifiers are assigned in order of first use, and remain valid for the lifetime
+//! of the interner, regardless of the lifetime of the object associated with the
+//! name. This allows identifiers to be used directly as indices into other containers,
+//! and avoids the repeated hashing, copying and comparison of strings in the cyber
+//! engagement process.
+class WSF_CYBER_EXPORT Interner
+{
+public:
+   using Id = size_t;
+
+   //! The value returned when a name has not been interned.
+   static constexpr Id cNULL_ID = std::numeric_limits<Id>::max();
+
+   Interner()                     = default;
+   ~Interner()                    = default;
+   Interner(const Interner& aSrc) = delete;
+   Interner& operator=(const Interner& aRhs) = delete;
+   Interner(Interner&& aSrc)                 = default;
+   Interner& operator=(Interner&& aRhs) = default;
+
+   //! Returns the identifier for the name, assigning a new identifier if necessary.
+   Id Intern(const std::string& aName);
+
+   //! Returns the identifier for the name, or cNULL_ID if the name has not been interned.
+   Id Find(const std::string& aName) const;
+
+   //! Returns the name associated with a valid identifier.
+   const std::string& GetName(Id aId) const { return *mNames[aId]; }
+
+   bool   IsValid(Id aId) const { return (aId < mNames.size()); }
+   size_t GetSize() const { return mNames.size(); }
+
+private:
+   std::unordered_map<std::string, Id> mIds{};
+
+   //! Indexed by identifier. Points to the key held by mIds, which is
+   //! stable for the lifetime of the entry.
+   std::vector<const std::string*> mNames{};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
@@ -0,0 +1,374 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFCYBEROBJECTPOOL_HPP
+#define WSFCYBEROBJECTPOOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! A slab allocator for objects of a single type. Storage is acquired in slabs of
+//! multiple objects, and storage for destroyed objects is recycled for subsequent objects.
+//! Storage is only returned to the system when the pool is destroyed.
+//! @note The pool does not track the objects it has created. All objects must be
+//! destroyed prior to the destruction of the pool.
+template<class T, size_t SLAB_SIZE = 64U>
+class ObjectPool
+{
+public:
+   //! Deleter for use with std::unique_ptr, returning the object to the pool.
+   class Deleter
+   {
+   public:
+      Deleter() = default;
+      explicit Deleter(ObjectPool* aPoolPtr)
+         : mPoolPtr(aPoolPtr)
+      {
+      }
+
+      void operator()(T* aObjectPtr) const
+      {
+         if (mPoolPtr)
+         {
+            mPoolPtr->Destroy(aObjectPtr);
+         }
+      }
+
+   private:
+      ObjectPool* mPoolPtr{nullptr};
+   };
+
+   using Pointer = std::unique_ptr<T, Deleter>;
+
+   ObjectPool()                       = default;
+   ~ObjectPool()                      = default;
+   ObjectPool(const ObjectPool& aSrc) = delete;
+   ObjectPool& operator=(const ObjectPool& aRhs) = delete;
+
+   //! Constructs an object in storage provided by the pool.
+   template<class... ARGS>
+   T* Create(ARGS&&... aArgs)
+   {
+      auto nodePtr = Acquire();
+      try
+      {
+         return new (nodePtr->mStorage) T(std::forward<ARGS>(aArgs)...);
+      }
+      catch (...)
+      {
+         Release(nodePtr);
+         throw;
+      }
+   }
+
+   //! Constructs an object in storage provided by the pool, owned by the returned pointer.
+   template<class... ARGS>
+   Pointer Make(ARGS&&... aArgs)
+   {
+      return Pointer(Create(std::forward<ARGS>(aArgs)...), Deleter(this));
+   }
+
+   //! Destroys an object created by this pool, making its storage available for reuse.
+   void Destroy(T* aObjectPtr)
+   {
+      if (aObjectPtr)
+      {
+         aObjectPtr->~T();
+         Release(reinterpret_cast<Node*>(aObjectPtr));
+      }
+   }
+
+   size_t GetCapacity() const { return mSlabs.size() * SLAB_SIZE; }
+   size_t GetInUse() const { return mInUse; }
+
+private:
+   union Node
+   {
+      Node* mNext;
+      alignas(T) unsigned char mStorage[sizeof(T)];
+   };
+
+   Node* Acquire()
+   {
+      if (!mFreeListPtr)
+      {
+         mSlabs.emplace_back(new Node[SLAB_SIZE]);
+         auto& slab = mSlabs.back();
+         for (size_t i = 0U; i < SLAB_SIZE; ++i)
+         {
+            slab[i].mNext = mFreeListPtr;
+            mFreeListPtr  = &slab[i];
+         }
+      }
+
+      auto nodePtr = mFreeListPtr;
+      mFreeListPtr = nodePtr->mNext;
+      ++mInUse;
+      return nodePtr;
+   }
+
+   void Release(Node* aNodePtr)
+   {
+      aNodePtr->mNext = mFreeListPtr;
+      mFreeListPtr    = aNodePtr;
+      --mInUse;
+   }
+
+   std::vector<std::unique_ptr<Node[]>> mSlabs{};
+   Node*                                mFreeListPtr{nullptr};
+   size_t                               mInUse{0U};
+};
+
+//! A recycler of fixed size blocks of raw storage, intended for the nodes of node based
+//! containers. The block size is established by the first allocation. Requests of any other
+//! size are forwarded to the global allocator.
+//! @note As with ObjectPool, storage is only returned to the system when the pool is destroyed,
+//! and the pool must outlive any container using it.
+class BlockPool
+{
+public:
+   BlockPool()                      = default;
+   ~BlockPool()                     = default;
+   BlockPool(const BlockPool& aSrc) = delete;
+   BlockPool& operator=(const BlockPool& aRhs) = delete;
+
+   void* Allocate(size_t aSize)
+   {
+      if (mBlockSize == 0U)
+      {
+         mBlockSize = aSize;
+      }
+
+      if (aSize != mBlockSize)
+      {
+         return ::operator new(aSize);
+      }
+
+      if (!mFreeListPtr)
+      {
+         Grow();
+      }
+
+      auto blockPtr = mFreeListPtr;
+      mFreeListPtr  = blockPtr->mNext;
+      return blockPtr;
+   }
+
+   void Deallocate(void* aPtr, size_t aSize)
+   {
+      if (aSize != mBlockSize)
+      {
+         ::operator delete(aPtr);
+         return;
+      }
+
+      auto blockPtr   = static_cast<Block*>(aPtr);
+      blockPtr->mNext = mFreeListPtr;
+      mFreeListPtr    = blockPtr;
+   }
+
+private:
+   static constexpr size_t cBLOCKS_PER_SLAB = 256U;
+
+   struct Block
+   {
+      Block* mNext;
+   };
+
+   using Storage = std::max_align_t;
+
+   void Grow()
+   {
+      //! Round the block size up to maintain the fundamental alignment of each block.
+      auto storagePerBlock = (std::max(mBlockSize, sizeof(Block)) + sizeof(Storage) - 1U) / sizeof(Storage);
+      mSlabs.emplace_back(new Storage[storagePerBlock * cBLOCKS_PER_SLAB]);
+
+      auto slabPtr = mSlabs.back().get();
+      for (size_t i = 0U; i < cBLOCKS_PER_SLAB; ++i)
+      {
+         auto blockPtr   = reinterpret_cast<Block*>(slabPtr + (i * storagePerBlock));
+         blockPtr->mNext = mFreeListPtr;
+         mFreeListPtr    = blockPtr;
+      }
+   }
+
+   std::vector<std::unique_ptr<Storage[]>> mSlabs{};
+   Block*                                  mFreeListPtr{nullptr};
+   size_t                                  mBlockSize{0U};
+};
+
+//! Recyclers of the storage of PooledSlots, with a BlockPool for each block capacity.
+//! Block capacities are powers of two from cMIN_CAPACITY, and blocks larger than the
+//! largest pooled capacity are provided by the global allocator.
+class SlotBlockPool
+{
+public:
+   static constexpr size_t cMIN_CAPACITY = 4U;
+   static constexpr size_t cCLASS_COUNT  = 8U;
+
+   SlotBlockPool()                          = default;
+   ~SlotBlockPool()                         = default;
+   SlotBlockPool(const SlotBlockPool& aSrc) = delete;
+   SlotBlockPool& operator=(const SlotBlockPool& aRhs) = delete;
+
+   //! Returns the capacity class of the smallest block with at least the provided capacity.
+   static size_t GetCapacityClass(size_t aCapacity)
+   {
+      size_t capacityClass = 0U;
+      while ((cMIN_CAPACITY << capacityClass) < aCapacity)
+      {
+         ++capacityClass;
+      }
+      return capacityClass;
+   }
+
+   static size_t GetCapacity(size_t aCapacityClass) { return (cMIN_CAPACITY << aCapacityClass); }
+
+   void* Allocate(size_t aCapacityClass, size_t aSize)
+   {
+      if (aCapacityClass < cCLASS_COUNT)
+      {
+         return mPools[aCapacityClass].Allocate(aSize);
+      }
+      return ::operator new(aSize);
+   }
+
+   void Deallocate(void* aPtr, size_t aCapacityClass, size_t aSize)
+   {
+      if (aCapacityClass < cCLASS_COUNT)
+      {
+         mPools[aCapacityClass].Deallocate(aPtr, aSize);
+      }
+      else
+      {
+         ::operator delete(aPtr);
+      }
+   }
+
+private:
+   BlockPool mPools[cCLASS_COUNT];
+};
+
+//! An indexed sequence of slots, held in a single contiguous block drawn from a SlotBlockPool.
+//! As with std::vector, slots are moved to a larger block as the sequence grows.
+//! @note The block is retained when the sequence is cleared, such that a reused sequence
+//! requires no allocation. The block is returned to the pool when the sequence is destroyed.
+template<class T>
+class PooledSlots
+{
+public:
+   explicit PooledSlots(SlotBlockPool& aPool)
+      : mPoolPtr(&aPool)
+   {
+   }
+
+   ~PooledSlots()
+   {
+      clear();
+      ReleaseBlock();
+   }
+
+   PooledSlots(const PooledSlots& aSrc) = delete;
+   PooledSlots& operator=(const PooledSlots& aRhs) = delete;
+
+   PooledSlots(PooledSlots&& aSrc) noexcept
+      : mPoolPtr(aSrc.mPoolPtr)
+      , mSlotsPtr(aSrc.mSlotsPtr)
+      , mSize(aSrc.mSize)
+      , mCapacityClass(aSrc.mCapacityClass)
+   {
+      aSrc.mSlotsPtr = nullptr;
+      aSrc.mSize     = 0U;
+   }
+
+   size_t size() const { return mSize; }
+   size_t capacity() const { return mSlotsPtr ? SlotBlockPool::GetCapacity(mCapacityClass) : 0U; }
+   bool   empty() const { return (mSize == 0U); }
+
+   //! @note The index must be less than size().
+   //@{
+   T&       operator[](size_t aIndex) { return mSlotsPtr[aIndex]; }
+   const T& operator[](size_t aIndex) const { return mSlotsPtr[aIndex]; }
+   //@}
+
+   //! Changes the number of slots. Added slots hold a default constructed value.
+   void resize(size_t aSize)
+   {
+      if (aSize > capacity())
+      {
+         Reserve(aSize);
+      }
+      for (; mSize < aSize; ++mSize)
+      {
+         new (mSlotsPtr + mSize) T();
+      }
+      for (; mSize > aSize; --mSize)
+      {
+         mSlotsPtr[mSize - 1U].~T();
+      }
+   }
+
+   //! Removes the slot, moving each following slot down by one.
+   void erase(size_t aIndex)
+   {
+      for (auto i = aIndex + 1U; i < mSize; ++i)
+      {
+         mSlotsPtr[i - 1U] = std::move(mSlotsPtr[i]);
+      }
+      resize(mSize - 1U);
+   }
+
+   void clear() { resize(0U); }
+
+private:
+   void Reserve(size_t aCapacity)
+   {
+      auto capacityClass = SlotBlockPool::GetCapacityClass(aCapacity);
+      auto blockSize     = SlotBlockPool::GetCapacity(capacityClass) * sizeof(T);
+      auto slotsPtr      = static_cast<T*>(mPoolPtr->Allocate(capacityClass, blockSize));
+      for (size_t i = 0U; i < mSize; ++i)
+      {
+         new (slotsPtr + i) T(std::move(mSlotsPtr[i]));
+         mSlotsPtr[i].~T();
+      }
+      ReleaseBlock();
+      mSlotsPtr      = slotsPtr;
+      mCapacityClass = capacityClass;
+   }
+
+   void ReleaseBlock()
+   {
+      if (mSlotsPtr)
+      {
+         mPoolPtr->Deallocate(mSlotsPtr, mCapacityClass, SlotBlockPool::GetCapacity(mCapacityClass) * sizeof(T));
+         mSlotsPtr = nullptr;
+      }
+   }
+
+   SlotBlockPool* mPoolPtr;
+   T*             mSlotsPtr{nullptr};
+   size_t         mSize{0U};
+   size_t         mCapacityClass{0U};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
@@ -0,0 +1,138 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberObserverDispatcher.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace wsf
+{
+namespace cyber
+{
+
+constexpr size_t ObserverDispatcher::cDEFAULT_CAPACITY;
+constexpr size_t ObserverDispatcher::cDEFAULT_BATCH_SIZE;
+
+namespace
+{
+//! The number of times an idle thread yields before sleeping, and the duration of the sleep.
+constexpr unsigned int cYIELD_LIMIT = 64U;
+constexpr auto         cIDLE_SLEEP  = std::chrono::microseconds(100);
+
+void Wait(unsigned int& aIdleCount)
+{
+   if (aIdleCount < cYIELD_LIMIT)
+   {
+      ++aIdleCount;
+      std::this_thread::yield();
+   }
+   else
+   {
+      std::this_thread::sleep_for(cIDLE_SLEEP);
+   }
+}
+} // namespace
+
+// =================================================================================================
+ObserverDispatcher::ObserverDispatcher(size_t aCapacity,  // = cDEFAULT_CAPACITY
+                                       size_t aBatchSize) // = cDEFAULT_BATCH_SIZE
+   : mQueue(aCapacity)
+   , mBatchSize(std::max<size_t>(aBatchSize, 1U))
+   , mThread(&ObserverDispatcher::Run, this)
+{
+}
+
+// =================================================================================================
+ObserverDispatcher::~ObserverDispatcher()
+{
+   Stop();
+}
+
+// =================================================================================================
+void ObserverDispatcher::Subscribe(const Subscriber& aSubscriber)
+{
+   std::lock_guard<std::mutex> lock(mSubscriberMutex);
+   mSubscribers.push_back(aSubscriber);
+}
+
+// =================================================================================================
+void ObserverDispatcher::Post(ObserverRecord aRecord)
+{
+   aRecord.mSequence = mPostedCount;
+   if (!mQueue.TryPush(aRecord))
+   {
+      ++mStallCount;
+      unsigned int idleCount = 0U;
+      while (!mQueue.TryPush(aRecord))
+      {
+         Wait(idleCount);
+      }
+   }
+   ++mPostedCount;
+}
+
+// =================================================================================================
+void ObserverDispatcher::Drain()
+{
+   unsigned int idleCount = 0U;
+   while (GetDeliveredCount() < mPostedCount)
+   {
+      Wait(idleCount);
+   }
+}
+
+// =================================================================================================
+void ObserverDispatcher::Stop()
+{
+   if (mThread.joinable())
+   {
+      mStopping.store(true, std::memory_order_release);
+      mThread.join();
+   }
+}
+
+// =================================================================================================
+void ObserverDispatcher::Run()
+{
+   std::vector<ObserverRecord> batch(mBatchSize);
+   unsigned int                idleCount = 0U;
+   while (true)
+   {
+      //! The stop request is read prior to the queue, such that records posted before the
+      //! request are delivered before the thread exits.
+      bool   stopping = mStopping.load(std::memory_order_acquire);
+      size_t count    = mQueue.PopBatch(batch.data(), batch.size());
+      if (count == 0U)
+      {
+         if (stopping)
+         {
+            return;
+         }
+         Wait(idleCount);
+         continue;
+      }
+
+      idleCount = 0U;
+      {
+         std::lock_guard<std::mutex> lock(mSubscriberMutex);
+         for (auto& subscriber : mSubscribers)
+         {
+            subscriber(batch.data(), count);
+         }
+      }
+      mDeliveredCount.fetch_add(count, std::memory_order_release);
+   }
+}
+
+} // namespace cyber
+} // namespace wsf
@@ -0,0 +1,123 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBEROBSERVERDISPATCHER_HPP
+#define WSFCYBEROBSERVERDISPATCHER_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "WsfCyberSpscQueue.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! A compact record of a cyber observer callback, for asynchronous dispatch.
+//! The engagement is identified by its key (see EngagementManager::DecodeKey()), whose attack
+//! type and platform identifiers are those interned by the EngagementManager.
+struct ObserverRecord
+{
+   enum Type : std::uint8_t
+   {
+      cATTACK_INITIATED,
+      cATTACK_SUCCEEDED,
+      cATTACK_FAILED,
+      cATTACK_DETECTED,
+      cATTACK_ATTRIBUTED,
+      cATTACK_RECOVERY,
+      cSCAN_INITIATED,
+      cSCAN_SUCCEEDED,
+      cSCAN_FAILED,
+      cSCAN_DETECTED,
+      cSCAN_ATTRIBUTED
+   };
+
+   std::uint64_t mSequence;
+   double        mSimTime;
+   size_t        mKey;
+   Type          mType;
+   std::uint8_t  mAttackFailure; //!< Engagement::CyberAttackFailure
+   std::uint8_t  mScanFailure;   //!< Engagement::CyberScanFailure
+   bool          mStatusReported;
+};
+
+//! Dispatches observer records to subscribers on a background thread, in batches.
+//!
+//! Records are posted by the simulation thread to a lock-free queue (see SpscQueue), and only a
+//! single thread may post. Delivery is guaranteed and ordered:
+//! - Every posted record is delivered to every subscriber, and no record is dropped. If the queue
+//!   is full, Post() waits for the dispatch thread to make room (see GetStallCount()).
+//! - Records are delivered in the order posted, as indicated by their consecutive sequence numbers.
+//! - Each batch is delivered to every subscriber, in the order subscribed, before the next batch is
+//!   delivered to any subscriber.
+//! - Every record posted prior to a call to Drain() has been delivered when Drain() returns.
+//! Subscribers are invoked on the dispatch thread, and must not access simulation objects.
+class WSF_CYBER_EXPORT ObserverDispatcher
+{
+public:
+   using Subscriber = std::function<void(const ObserverRecord* aRecords, size_t aCount)>;
+
+   static constexpr size_t cDEFAULT_CAPACITY   = 16384U;
+   static constexpr size_t cDEFAULT_BATCH_SIZE = 256U;
+
+   explicit ObserverDispatcher(size_t aCapacity = cDEFAULT_CAPACITY, size_t aBatchSize = cDEFAULT_BATCH_SIZE);
+   ~ObserverDispatcher();
+   ObserverDispatcher(const ObserverDispatcher& aSrc) = delete;
+   ObserverDispatcher& operator=(const ObserverDispatcher& aRhs) = delete;
+
+   //! Adds a subscriber, which receives every batch delivered after this call.
+   void Subscribe(const Subscriber& aSubscriber);
+
+   //! Posts the record, assigning its sequence number.
+   void Post(ObserverRecord aRecord);
+
+   //! Waits until every posted record has been delivered.
+   void Drain();
+
+   //! Delivers every posted record and stops the dispatch thread. No records may be posted after.
+   void Stop();
+
+   std::uint64_t GetPostedCount() const { return mPostedCount; }
+   std::uint64_t GetDeliveredCount() const { return mDeliveredCount.load(std::memory_order_acquire); }
+   std::uint64_t GetStallCount() const { return mStallCount; }
+
+private:
+   void Run();
+
+   SpscQueue<ObserverRecord> mQueue;
+   size_t                    mBatchSize;
+
+   //! Accessed by the posting thread only.
+   std::uint64_t mPostedCount{0U};
+   std::uint64_t mStallCount{0U};
+
+   std::atomic<std::uint64_t> mDeliveredCount{0U};
+   std::atomic<bool>          mStopping{false};
+
+   std::mutex              mSubscriberMutex;
+   std::vector<Subscriber> mSubscribers;
+   std::thread             mThread;
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
@@ -0,0 +1,194 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberReplicationRunner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "UtLog.hpp"
+#include "WsfCyberEngagementManager.hpp"
+#include "WsfSimulation.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+// =================================================================================================
+bool ReplicationRunner::EngagementName::operator<(const EngagementName& aRhs) const
+{
+   return std::tie(mAttackType, mAttacker, mVictim) < std::tie(aRhs.mAttackType, aRhs.mAttacker, aRhs.mVictim);
+}
+
+// =================================================================================================
+void ReplicationRunner::OutcomeCounts::Merge(const OutcomeCounts& aCounts)
+{
+   mAttempts += aCounts.mAttempts;
+   mSuccesses += aCounts.mSuccesses;
+   mStatusReports += aCounts.mStatusReports;
+   mDetections += aCounts.mDetections;
+   mAttributions += aCounts.mAttributions;
+   mImmunities += aCounts.mImmunities;
+   mRecoveries += aCounts.mRecoveries;
+   mReplicatesWithSuccess += aCounts.mReplicatesWithSuccess;
+}
+
+// =================================================================================================
+ReplicationRunner::ReplicationRunner(SimulationFactory aFactory)
+   : mFactory(std::move(aFactory))
+{
+}
+
+// =================================================================================================
+void ReplicationRunner::SetReplicates(unsigned int aReplicates, unsigned int aFirstRunNumber) // = 1U
+{
+   mReplicates     = aReplicates;
+   mFirstRunNumber = aFirstRunNumber;
+}
+
+// =================================================================================================
+ReplicationRunner::Statistics ReplicationRunner::Run()
+{
+   std::vector<Statistics> results(mReplicates);
+
+   //! Each thread takes the next replicate not yet started, until none remain.
+   std::atomic<unsigned int> nextReplicate{0U};
+   auto                      worker = [this, &results, &nextReplicate]()
+   {
+      for (auto i = nextReplicate++; i < mReplicates; i = nextReplicate++)
+      {
+         Replicate replicate{mFirstRunNumber + i, GetSeed(mBaseSeed, mFirstRunNumber + i)};
+         results[i] = RunReplicate(replicate);
+      }
+   };
+
+   auto threadCount = (mThreadCount != 0U) ? mThreadCount : std::max(std::thread::hardware_concurrency(), 1U);
+   threadCount      = std::min(threadCount, std::max(mReplicates, 1U));
+
+   //! The calling thread also runs replicates.
+   std::vector<std::thread> threads;
+   threads.reserve(threadCount - 1U);
+   for (unsigned int i = 1U; i < threadCount; ++i)
+   {
+      threads.emplace_back(worker);
+   }
+   worker();
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   Statistics statistics;
+   for (const auto& result : results)
+   {
+      statistics.mReplicates += result.mReplicates;
+      statistics.mFailedReplicates += result.mFailedReplicates;
+      statistics.mTotal.Merge(result.mTotal);
+      for (const auto& engagement : result.mEngagements)
+      {
+         statistics.mEngagements[engagement.first].Merge(engagement.second);
+      }
+   }
+
+   return statistics;
+}
+
+// =================================================================================================
+std::uint64_t ReplicationRunner::GetSeed(std::uint64_t aBaseSeed, unsigned int aRunNumber)
+{
+   //! SplitMix64 finalizer, such that consecutive run numbers provide unrelated seeds.
+   std::uint64_t seed = aBaseSeed + (static_cast<std::uint64_t>(aRunNumber) * 0x9E3779B97F4A7C15ULL);
+   seed               = (seed ^ (seed >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+   seed               = (seed ^ (seed >> 27U)) * 0x94D049BB133111EBULL;
+   return seed ^ (seed >> 31U);
+}
+
+// =================================================================================================
+ReplicationRunner::Statistics ReplicationRunner::RunReplicate(const Replicate& aReplicate) const
+{
+   Statistics statistics;
+   statistics.mReplicates = 1U;
+   try
+   {
+      auto simulationPtr = mFactory(aReplicate);
+      if (!simulationPtr)
+      {
+         auto out = ut::log::error() << "Unable to create simulation for cyber replicate.";
+         out.AddNote() << "Run Number: " << aReplicate.mRunNumber;
+         statistics.mFailedReplicates = 1U;
+         return statistics;
+      }
+
+      //! Each replicate draws from its own stream, regardless of how the factory seeded the simulation.
+      auto& simulation = *simulationPtr;
+      EngagementManager::Get(simulation).UseCounterBasedDraws(aReplicate.mSeed);
+      simulation.Start();
+      while (simulation.IsActive())
+      {
+         simulation.AdvanceTime();
+      }
+      simulation.Complete(simulation.GetSimTime());
+
+      //! Engagement keys are specific to this simulation, so outcomes are gathered by name.
+      const auto& manager = EngagementManager::Get(simulation);
+      manager.GetHistory().ForEach(
+         [&manager, &statistics](const EngagementHistory::Record& aRecord)
+         {
+            Interner::Id attackTypeId;
+            Interner::Id attackerId;
+            Interner::Id victimId;
+            EngagementManager::DecodeKey(aRecord.mKey, attackTypeId, attackerId, victimId);
+
+            EngagementName name{manager.GetAttackTypeIds().GetName(attackTypeId),
+                                manager.GetPlatformIds().GetName(attackerId),
+                                manager.GetPlatformIds().GetName(victimId)};
+
+            auto& counts = statistics.mEngagements[name];
+            ++counts.mAttempts;
+            counts.mSuccesses += aRecord.mAttackSuccess ? 1U : 0U;
+            counts.mStatusReports += aRecord.mStatusReported ? 1U : 0U;
+            counts.mDetections += aRecord.mAttackDetected ? 1U : 0U;
+            counts.mAttributions += aRecord.mAttackAttributed ? 1U : 0U;
+            counts.mImmunities += aRecord.mImmunity ? 1U : 0U;
+            counts.mRecoveries += aRecord.mRecovered ? 1U : 0U;
+         });
+
+      bool anySuccess = false;
+      for (auto& engagement : statistics.mEngagements)
+      {
+         auto& counts                  = engagement.second;
+         counts.mReplicatesWithSuccess = (counts.mSuccesses > 0U) ? 1U : 0U;
+         anySuccess                    = anySuccess || (counts.mSuccesses > 0U);
+         statistics.mTotal.Merge(counts);
+      }
+      statistics.mTotal.mReplicatesWithSuccess = anySuccess ? 1U : 0U;
+   }
+   catch (const std::exception& aException)
+   {
+      auto out = ut::log::error() << "Exception thrown during cyber replicate.";
+      out.AddNote() << "Run Number: " << aReplicate.mRunNumber;
+      out.AddNote() << "Exception: " << aException.what();
+      statistics                   = Statistics();
+      statistics.mReplicates       = 1U;
+      statistics.mFailedReplicates = 1U;
+   }
+
+   return statistics;
+}
+
+} // namespace cyber
+} // namespace wsf
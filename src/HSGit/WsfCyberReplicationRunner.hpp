@@ -0,0 +1,133 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERREPLICATIONRUNNER_HPP
+#define WSFCYBERREPLICATIONRUNNER_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+class WsfSimulation;
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! Runs independent replications (Monte Carlo runs) of a cyber scenario concurrently, and
+//! merges the attack outcomes of every replicate into aggregate statistics.
+//!
+//! Each replicate is an independent simulation, with its own engagement and event managers,
+//! created by the factory provided by the application. Replicates are distributed across a
+//! pool of threads, with each thread running one simulation at a time to completion. Every
+//! replicate is provided a unique run number and a seed derived from the base seed and that run
+//! number. The runner uses the seed for the counter based cyber draws of the replicate (see
+//! EngagementManager::UseCounterBasedDraws), such that every replicate has its own draw stream.
+//! The factory may also use the seed for the other random draws of the simulation.
+//! Results are merged in run number order, such that the statistics do not depend on the
+//! number of threads or the order in which replicates complete.
+//!
+//! Outcomes are taken from the engagement history of each replicate (see EngagementHistory).
+//! Attack attempts beyond the history capacity of a single replicate are not included.
+//! @note The factory is called concurrently from multiple threads. The application must ensure
+//! that simulations created by the factory may be created and run concurrently, such as by
+//! creating each from the same completely loaded scenario, which is not modified.
+class WSF_CYBER_EXPORT ReplicationRunner
+{
+public:
+   //! The identification of a single replicate.
+   struct Replicate
+   {
+      unsigned int  mRunNumber;
+      std::uint64_t mSeed;
+   };
+
+   //! Creates an initialized simulation for the replicate, ready to be started, or nullptr
+   //! if the simulation could not be created.
+   using SimulationFactory = std::function<std::unique_ptr<WsfSimulation>(const Replicate&)>;
+
+   //! The names identifying an engagement, which are consistent across replicates.
+   struct EngagementName
+   {
+      std::string mAttackType;
+      std::string mAttacker;
+      std::string mVictim;
+
+      bool operator<(const EngagementName& aRhs) const;
+   };
+
+   //! Counts of attack attempt outcomes.
+   struct OutcomeCounts
+   {
+      size_t mAttempts{0U};
+      size_t mSuccesses{0U};
+      size_t mStatusReports{0U};
+      size_t mDetections{0U};
+      size_t mAttributions{0U};
+      size_t mImmunities{0U};
+      size_t mRecoveries{0U};
+
+      //! The number of replicates with at least one successful attack.
+      size_t mReplicatesWithSuccess{0U};
+
+      void Merge(const OutcomeCounts& aCounts);
+   };
+
+   struct Statistics
+   {
+      size_t                                  mReplicates{0U};
+      size_t                                  mFailedReplicates{0U};
+      OutcomeCounts                           mTotal{};
+      std::map<EngagementName, OutcomeCounts> mEngagements{};
+   };
+
+   explicit ReplicationRunner(SimulationFactory aFactory);
+   ~ReplicationRunner()                             = default;
+   ReplicationRunner(const ReplicationRunner& aSrc) = delete;
+   ReplicationRunner& operator=(const ReplicationRunner& aRhs) = delete;
+
+   //! Sets the number of replicates, run with the consecutive run numbers starting at the first run number.
+   void SetReplicates(unsigned int aReplicates, unsigned int aFirstRunNumber = 1U);
+
+   //! Sets the number of threads used. Zero (the default) uses the number of hardware threads.
+   void SetThreadCount(unsigned int aThreadCount) { mThreadCount = aThreadCount; }
+
+   void SetBaseSeed(std::uint64_t aBaseSeed) { mBaseSeed = aBaseSeed; }
+
+   //! Runs every replicate to completion, returning the merged statistics. A replicate that
+   //! fails (the factory provides no simulation, or an exception is thrown) is reported, and
+   //! counted in Statistics::mFailedReplicates.
+   Statistics Run();
+
+   //! Returns the seed for the run number. Seeds are well distributed for consecutive run numbers.
+   static std::uint64_t GetSeed(std::uint64_t aBaseSeed, unsigned int aRunNumber);
+
+private:
+   //! Runs a single replicate, returning its statistics.
+   Statistics RunReplicate(const Replicate& aReplicate) const;
+
+   SimulationFactory mFactory;
+   unsigned int      mReplicates{1U};
+   unsigned int      mFirstRunNumber{1U};
+   unsigned int      mThreadCount{0U};
+   std::uint64_t     mBaseSeed{0U};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
@@ -0,0 +1,119 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERSPSCQUEUE_HPP
+#define WSFCYBERSPSCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! A bounded, lock-free queue for a single producer thread and a single consumer thread.
+//! The capacity is rounded up to a power of two. Each position is owned by one thread and read by
+//! the other, and the positions are kept on separate cache lines so that the producer and consumer
+//! do not contend for the same line. Each thread also caches the position of the other, only
+//! reloading it when the queue appears full (producer) or empty (consumer).
+template<class T>
+class SpscQueue
+{
+public:
+   explicit SpscQueue(size_t aCapacity)
+      : mSlots(RoundUp(aCapacity))
+      , mMask(mSlots.size() - 1U)
+   {
+   }
+
+   ~SpscQueue()                     = default;
+   SpscQueue(const SpscQueue& aSrc) = delete;
+   SpscQueue& operator=(const SpscQueue& aRhs) = delete;
+
+   //! Producer only. Appends the value, returning false if the queue is full.
+   bool TryPush(const T& aValue)
+   {
+      auto tail = mTail.load(std::memory_order_relaxed);
+      if ((tail - mCachedHead) == mSlots.size())
+      {
+         mCachedHead = mHead.load(std::memory_order_acquire);
+         if ((tail - mCachedHead) == mSlots.size())
+         {
+            return false;
+         }
+      }
+
+      mSlots[tail & mMask] = aValue;
+      mTail.store(tail + 1U, std::memory_order_release);
+      return true;
+   }
+
+   //! Consumer only. Removes up to the number of values requested, in order, returning the
+   //! number of values removed.
+   size_t PopBatch(T* aValues, size_t aMaxCount)
+   {
+      auto head = mHead.load(std::memory_order_relaxed);
+      if (head == mCachedTail)
+      {
+         mCachedTail = mTail.load(std::memory_order_acquire);
+      }
+
+      size_t count = mCachedTail - head;
+      if (count > aMaxCount)
+      {
+         count = aMaxCount;
+      }
+      for (size_t i = 0U; i < count; ++i)
+      {
+         aValues[i] = mSlots[(head + i) & mMask];
+      }
+
+      mHead.store(head + count, std::memory_order_release);
+      return count;
+   }
+
+   size_t GetCapacity() const { return mSlots.size(); }
+
+private:
+   static constexpr size_t cCACHE_LINE_SIZE = 64U;
+
+   static size_t RoundUp(size_t aCapacity)
+   {
+      size_t capacity = 2U;
+      while (capacity < aCapacity)
+      {
+         capacity <<= 1U;
+      }
+      return capacity;
+   }
+
+   std::vector<T> mSlots;
+   size_t         mMask;
+
+   //! Written by the consumer.
+   char                mPadding0[cCACHE_LINE_SIZE];
+   std::atomic<size_t> mHead{0U};
+   size_t              mCachedTail{0U};
+
+   //! Written by the producer.
+   char                mPadding1[cCACHE_LINE_SIZE];
+   std::atomic<size_t> mTail{0U};
+   size_t              mCachedHead{0U};
+   char                mPadding2[cCACHE_LINE_SIZE];
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
@@ -0,0 +1,150 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberStandaloneHost.hpp"
+
+#include "WsfCyberCounterRandom.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+namespace kernel
+{
+
+// =================================================================================================
+StandaloneHost::StandaloneHost(std::uint64_t aSeed) // = 0
+   : mKernel(*this)
+   , mSeed(aSeed)
+{
+}
+
+// =================================================================================================
+void StandaloneHost::AddPlatform(Interner::Id aPlatformId)
+{
+   if (aPlatformId >= mPlatforms.size())
+   {
+      mPlatforms.resize(aPlatformId + 1U, false);
+   }
+   mPlatforms[aPlatformId] = true;
+}
+
+// =================================================================================================
+void StandaloneHost::RemovePlatform(Interner::Id aPlatformId)
+{
+   if (aPlatformId < mPlatforms.size())
+   {
+      mPlatforms[aPlatformId] = false;
+   }
+}
+
+// =================================================================================================
+std::size_t StandaloneHost::AdvanceTime(double aEndTime)
+{
+   std::size_t processed = 0U;
+   while (!mEvents.empty() && mEvents.top().mTime <= aEndTime)
+   {
+      auto event = mEvents.top();
+      mEvents.pop();
+
+      mTime = event.mTime;
+      mKernel.Process(event.mPhase, event.mEngagement);
+      ++processed;
+   }
+
+   if (aEndTime > mTime)
+   {
+      mTime = aEndTime;
+   }
+   return processed;
+}
+
+// =================================================================================================
+std::size_t StandaloneHost::Run()
+{
+   std::size_t processed = 0U;
+   while (!mEvents.empty())
+   {
+      processed += AdvanceTime(mEvents.top().mTime);
+   }
+   return processed;
+}
+
+// =================================================================================================
+void StandaloneHost::Reset(std::uint64_t aSeed)
+{
+   mKernel.Clear();
+   mTime     = 0.0;
+   mSeed     = aSeed;
+   mSequence = 0U;
+   mEvents   = std::priority_queue<Event>();
+   mImmunities.Clear();
+   mNotificationCounts.fill(0U);
+}
+
+// =================================================================================================
+void StandaloneHost::Schedule(double aTime, Phase aPhase, std::size_t aEngagement)
+{
+   mEvents.push(Event{aTime, mSequence++, aPhase, aEngagement});
+}
+
+// =================================================================================================
+bool StandaloneHost::PlatformExists(Interner::Id aPlatformId) const
+{
+   return (aPlatformId < mPlatforms.size()) && mPlatforms[aPlatformId];
+}
+
+// =================================================================================================
+bool StandaloneHost::Draw(const State& aState, ThresholdTable::Threshold aThreshold)
+{
+   //! As with the EngagementManager, each attempt provides a distinct position within the
+   //! engagement stream for each threshold. The stream is the identity of the engagement.
+   bool isScan   = ((aThreshold == ThresholdTable::cSCAN_DETECTION) || (aThreshold == ThresholdTable::cSCAN_ATTRIBUTION));
+   auto attempts = isScan ? aState.mScanAttempts : aState.mAttackAttempts;
+   auto stream   = (static_cast<std::uint64_t>(aState.mAttackTypeId) << 48U) ^
+                 (static_cast<std::uint64_t>(aState.mAttackerId) << 24U) ^
+                 static_cast<std::uint64_t>(aState.mVictimId);
+   auto position = (static_cast<std::uint64_t>(attempts) << 32U) | static_cast<std::uint32_t>(aThreshold);
+   return (random::CounterRandom::Uniform(mSeed, stream, position) <= aState.mParameters.mThresholds[aThreshold]);
+}
+
+// =================================================================================================
+bool StandaloneHost::IsVictimImmune(const State& aState) const
+{
+   return mImmunities.Contains(GetImmunityKey(aState));
+}
+
+// =================================================================================================
+void StandaloneHost::SetVictimImmune(const State& aState)
+{
+   mImmunities.Emplace(GetImmunityKey(aState), true);
+}
+
+// =================================================================================================
+void StandaloneHost::Notify(Notification aNotification, const State& aState)
+{
+   ++mNotificationCounts[static_cast<std::size_t>(aNotification)];
+   if (mCallback)
+   {
+      mCallback(aNotification, aState);
+   }
+}
+
+// =================================================================================================
+FlatMap<bool>::Key StandaloneHost::GetImmunityKey(const State& aState)
+{
+   return (static_cast<FlatMap<bool>::Key>(aState.mVictimId) << 32U) | aState.mAttackTypeId;
+}
+
+} // namespace kernel
+} // namespace cyber
+} // namespace wsf
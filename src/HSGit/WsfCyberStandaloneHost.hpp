@@ -0,0 +1,119 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERSTANDALONEHOST_HPP
+#define WSFCYBERSTANDALONEHOST_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "WsfCyberEngagementKernel.hpp"
+#include "WsfCyberFlatMap.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+namespace kernel
+{
+
+//! A lightweight host for the engagement kernel, allowing engagements to be executed without a
+//! simulation. The host provides its own event queue and clock, a set of existing platforms, and
+//! counter based draws (see random::CounterRandom) such that results depend only upon the seed
+//! and the sequence of requests. Notifications are counted, and may optionally be forwarded.
+class WSF_CYBER_EXPORT StandaloneHost : public Host
+{
+public:
+   using NotificationCallback = std::function<void(Notification, const State&)>;
+   using NotificationCounts   = std::array<std::size_t, static_cast<std::size_t>(Notification::cNOTIFICATION_COUNT)>;
+
+   explicit StandaloneHost(std::uint64_t aSeed = 0U);
+   ~StandaloneHost() override                 = default;
+   StandaloneHost(const StandaloneHost& aSrc) = delete;
+   StandaloneHost& operator=(const StandaloneHost& aRhs) = delete;
+
+   Kernel&       GetKernel() { return mKernel; }
+   const Kernel& GetKernel() const { return mKernel; }
+
+   void AddPlatform(Interner::Id aPlatformId);
+   void RemovePlatform(Interner::Id aPlatformId);
+
+   void SetNotificationCallback(const NotificationCallback& aCallback) { mCallback = aCallback; }
+
+   //! Processes scheduled phases in time order until none remain at or before the end time.
+   //! The clock is advanced to the end time, and the number of phases processed is returned.
+   std::size_t AdvanceTime(double aEndTime);
+
+   //! Processes every scheduled phase, returning the number of phases processed.
+   std::size_t Run();
+
+   std::size_t               GetPendingCount() const { return mEvents.size(); }
+   const NotificationCounts& GetNotificationCounts() const { return mNotificationCounts; }
+   std::size_t GetNotificationCount(Notification aNotification) const
+   {
+      return mNotificationCounts[static_cast<std::size_t>(aNotification)];
+   }
+
+   //! Resets the clock, pending phases, immunities and counts, and removes every engagement.
+   //! Platforms are retained.
+   void Reset(std::uint64_t aSeed);
+
+   //! @name Host interface
+   //@{
+   double GetTime() const override { return mTime; }
+   void   Schedule(double aTime, Phase aPhase, std::size_t aEngagement) override;
+   void   Continue(Phase aPhase, std::size_t aEngagement) override { mKernel.Process(aPhase, aEngagement); }
+   bool   PlatformExists(Interner::Id aPlatformId) const override;
+   bool   Draw(const State& aState, ThresholdTable::Threshold aThreshold) override;
+   bool   IsVictimImmune(const State& aState) const override;
+   void   SetVictimImmune(const State& aState) override;
+   void   Notify(Notification aNotification, const State& aState) override;
+   //@}
+
+private:
+   struct Event
+   {
+      double        mTime;
+      std::uint64_t mSequence;
+      Phase         mPhase;
+      std::size_t   mEngagement;
+
+      //! Orders the queue by earliest time, then by order of scheduling.
+      bool operator<(const Event& aRhs) const
+      {
+         return (mTime != aRhs.mTime) ? (mTime > aRhs.mTime) : (mSequence > aRhs.mSequence);
+      }
+   };
+
+   static FlatMap<bool>::Key GetImmunityKey(const State& aState);
+
+   Kernel                     mKernel;
+   double                     mTime{0.0};
+   std::uint64_t              mSeed;
+   std::uint64_t              mSequence{0U};
+   std::priority_queue<Event> mEvents;
+   std::vector<bool>          mPlatforms;
+   FlatMap<bool>              mImmunities;
+   NotificationCounts         mNotificationCounts{};
+   NotificationCallback       mCallback;
+};
+
+} // namespace kernel
+} // namespace cyber
+} // namespace wsf
+
+#endif
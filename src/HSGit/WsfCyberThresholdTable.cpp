@@ -0,0 +1,98 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberThresholdTable.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace wsf
+{
+namespace cyber
+{
+constexpr ThresholdTable::Row ThresholdTable::cNO_ROW;
+constexpr size_t              ThresholdTable::cALIGNMENT;
+constexpr size_t              ThresholdTable::cVALUES_PER_LINE;
+
+// =================================================================================================
+ThresholdTable::Row ThresholdTable::Find(size_t aKey) const
+{
+   auto rowPtr = mRows.Find(aKey);
+   return rowPtr ? *rowPtr : cNO_ROW;
+}
+
+// =================================================================================================
+ThresholdTable::Row ThresholdTable::Add(size_t aKey, const Values& aValues)
+{
+   auto result = mRows.Emplace(aKey, mRowCount);
+   if (!result.second)
+   {
+      return *result.first;
+   }
+
+   if (mRowCount == mCapacity)
+   {
+      Grow();
+   }
+
+   auto row = mRowCount++;
+   for (size_t i = 0U; i < cTHRESHOLD_COUNT; ++i)
+   {
+      mStorage[GetColumnOffset(static_cast<Threshold>(i)) + row] = aValues[i];
+   }
+   return row;
+}
+
+// =================================================================================================
+ThresholdTable::Values ThresholdTable::GetValues(Row aRow) const
+{
+   Values values;
+   for (size_t i = 0U; i < cTHRESHOLD_COUNT; ++i)
+   {
+      values[i] = Get(aRow, static_cast<Threshold>(i));
+   }
+   return values;
+}
+
+// =================================================================================================
+void ThresholdTable::Clear()
+{
+   mStorage.clear();
+   mAlignmentOffset = 0U;
+   mCapacity        = 0U;
+   mRowCount        = 0U;
+   mRows.Clear();
+}
+
+// =================================================================================================
+void ThresholdTable::Grow()
+{
+   auto capacity = std::max(mCapacity * 2U, cVALUES_PER_LINE);
+
+   //! Allocate an additional cache line, such that the first column may be aligned.
+   std::vector<double> storage((capacity * cTHRESHOLD_COUNT) + cVALUES_PER_LINE, 0.0);
+   auto address         = reinterpret_cast<std::uintptr_t>(storage.data());
+   auto alignmentOffset = ((cALIGNMENT - (address % cALIGNMENT)) % cALIGNMENT) / sizeof(double);
+
+   for (size_t i = 0U; i < cTHRESHOLD_COUNT; ++i)
+   {
+      auto sourcePtr = mStorage.data() + GetColumnOffset(static_cast<Threshold>(i));
+      std::copy(sourcePtr, sourcePtr + mRowCount, storage.data() + alignmentOffset + (i * capacity));
+   }
+
+   mStorage.swap(storage);
+   mAlignmentOffset = alignmentOffset;
+   mCapacity        = capacity;
+}
+
+} // namespace cyber
+} // namespace wsf
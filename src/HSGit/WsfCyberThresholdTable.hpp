@@ -0,0 +1,101 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERTHRESHOLDTABLE_HPP
+#define WSFCYBERTHRESHOLDTABLE_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "WsfCyberFlatMap.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! A table of the engagement thresholds (probabilities) resulting from a single defining object
+//! (a protect type or an attack type) for a single attack type. Each row is identified by a key
+//! provided by the user, and holds the values used by every engagement sharing that definition.
+//!
+//! Values are stored by column, with each column aligned to a cache line. This allows for a
+//! single threshold to be evaluated across many rows (e.g. the probability of attack success
+//! for every known definition) by traversing contiguous memory.
+//! @note Rows are never removed, and row indices remain valid for the lifetime of the table.
+//! Column pointers are invalidated by the addition of rows.
+class WSF_CYBER_EXPORT ThresholdTable
+{
+public:
+   enum Threshold : size_t
+   {
+      cSTATUS_REPORT,
+      cATTACK_DETECTION,
+      cATTACK_ATTRIBUTION,
+      cSCAN_DETECTION,
+      cSCAN_ATTRIBUTION,
+      cATTACK_SUCCESS,
+      cIMMUNITY,
+      cTHRESHOLD_COUNT
+   };
+
+   using Row    = size_t;
+   using Values = std::array<double, cTHRESHOLD_COUNT>;
+
+   //! The value returned when no row exists for a key.
+   static constexpr Row cNO_ROW = std::numeric_limits<Row>::max();
+
+   ThresholdTable()                           = default;
+   ~ThresholdTable()                          = default;
+   ThresholdTable(const ThresholdTable& aSrc) = delete;
+   ThresholdTable& operator=(const ThresholdTable& aRhs) = delete;
+
+   //! Returns the row for the key, or cNO_ROW if no such row exists.
+   Row Find(size_t aKey) const;
+
+   //! Adds a row for the key with the values provided, returning the row.
+   //! If a row already exists for the key, it is returned unmodified.
+   Row Add(size_t aKey, const Values& aValues);
+
+   double Get(Row aRow, Threshold aThreshold) const { return GetColumn(aThreshold)[aRow]; }
+   Values GetValues(Row aRow) const;
+
+   //! Returns the values of a threshold for every row, indexed by row.
+   const double* GetColumn(Threshold aThreshold) const { return mStorage.data() + GetColumnOffset(aThreshold); }
+
+   size_t GetRowCount() const { return mRowCount; }
+
+   void Clear();
+
+private:
+   static constexpr size_t cALIGNMENT       = 64U;
+   static constexpr size_t cVALUES_PER_LINE = cALIGNMENT / sizeof(double);
+
+   size_t GetColumnOffset(Threshold aThreshold) const { return mAlignmentOffset + (aThreshold * mCapacity); }
+   void   Grow();
+
+   //! All columns are held in a single allocation. Each column holds mCapacity values,
+   //! a multiple of the values per cache line, and the first column begins at mAlignmentOffset.
+   std::vector<double> mStorage{};
+   size_t              mAlignmentOffset{0U};
+   size_t              mCapacity{0U};
+   size_t              mRowCount{0U};
+   FlatMap<Row>        mRows{};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
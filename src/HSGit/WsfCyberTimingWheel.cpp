@@ -0,0 +1,419 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberTimingWheel.hpp"
+
+#include <algorithm>
+
+#include "UtException.hpp"
+
+namespace
+{
+//! Returns the index of the lowest set bit of a non-zero value, using a de Bruijn sequence.
+size_t GetLowestBit(std::uint64_t aValue)
+{
+   static constexpr std::uint64_t cDE_BRUIJN = 0x03F79D71B4CB0A89ULL;
+   static constexpr unsigned char cINDEX[64] = {0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,
+                                                62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+                                                63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+                                                46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6};
+   return cINDEX[((aValue & (~aValue + 1U)) * cDE_BRUIJN) >> 58U];
+}
+} // namespace
+
+namespace wsf
+{
+namespace cyber
+{
+
+constexpr TimingWheel::Handle TimingWheel::cNO_HANDLE;
+constexpr double              TimingWheel::cDEFAULT_TICK_SIZE;
+constexpr unsigned int        TimingWheel::cSLOT_BITS;
+constexpr size_t              TimingWheel::cSLOT_COUNT;
+constexpr size_t              TimingWheel::cLEVEL_COUNT;
+constexpr size_t              TimingWheel::cWORD_COUNT;
+constexpr size_t              TimingWheel::cOVERFLOW_LIST;
+constexpr TimingWheel::Index  TimingWheel::cNO_INDEX;
+
+// =================================================================================================
+TimingWheel::TimingWheel(double aTickSize /* = cDEFAULT_TICK_SIZE */)
+   : mTickSize(aTickSize)
+{
+   if (!(mTickSize > 0.0))
+   {
+      throw UtException("Cyber timing wheel tick size must be positive.");
+   }
+   mHeads.fill(cNO_INDEX);
+}
+
+// =================================================================================================
+TimingWheel::Handle TimingWheel::Insert(double aTime, std::uint8_t aType, size_t aVictimId, size_t aKey)
+{
+   Index index = cNO_INDEX;
+   if (!mFreeIndices.empty())
+   {
+      index = mFreeIndices.back();
+      mFreeIndices.pop_back();
+   }
+   else
+   {
+      if (mNodes.size() >= static_cast<size_t>(cNO_INDEX))
+      {
+         throw UtException("Cyber timing wheel capacity exceeded.");
+      }
+      index = static_cast<Index>(mNodes.size());
+      mNodes.emplace_back();
+   }
+
+   auto  sequence = mSequence++;
+   auto  handle   = MakeHandle(index, sequence);
+   auto& node     = mNodes[index];
+   node.mRecord   = Record{aTime, sequence, aVictimId, aKey, handle, aType};
+   node.mTick     = GetTick(aTime);
+   node.mActive   = true;
+   ++mSize;
+   Place(index);
+   return handle;
+}
+
+// =================================================================================================
+bool TimingWheel::Cancel(Handle aHandle)
+{
+   auto index = GetIndex(aHandle);
+   if (index == cNO_INDEX)
+   {
+      return false;
+   }
+
+   Unlink(index);
+   Release(index);
+   return true;
+}
+
+// =================================================================================================
+bool TimingWheel::Contains(Handle aHandle) const
+{
+   return (GetIndex(aHandle) != cNO_INDEX);
+}
+
+// =================================================================================================
+double TimingWheel::GetNextTime() const
+{
+   auto nextTime = std::numeric_limits<double>::max();
+   for (auto index = mHeads[FindEarliestList()]; index != cNO_INDEX; index = mNodes[index].mNext)
+   {
+      nextTime = std::min(nextTime, mNodes[index].mRecord.mTime);
+   }
+   return nextTime;
+}
+
+// =================================================================================================
+void TimingWheel::PopDue(double aTime, std::vector<Record>& aRecords)
+{
+   auto       first      = aRecords.size();
+   const auto targetTick = GetTick(aTime);
+   while (mSize > 0U)
+   {
+      auto list = FindEarliestList();
+      if (list == cOVERFLOW_LIST)
+      {
+         // Only the overflow list remains. Move the wheel to the block of its earliest record.
+         auto minTick = std::numeric_limits<std::uint64_t>::max();
+         for (auto index = mHeads[list]; index != cNO_INDEX; index = mNodes[index].mNext)
+         {
+            minTick = std::min(minTick, mNodes[index].mTick);
+         }
+
+         const auto shift      = cSLOT_BITS * cLEVEL_COUNT;
+         const auto blockStart = (minTick >> shift) << shift;
+         if (blockStart > targetTick)
+         {
+            break;
+         }
+
+         auto index   = mHeads[list];
+         mHeads[list] = cNO_INDEX;
+         mCurrentTick = blockStart;
+         while (index != cNO_INDEX)
+         {
+            auto next = mNodes[index].mNext;
+            Place(index);
+            index = next;
+         }
+         continue;
+      }
+
+      const auto level = list / cSLOT_COUNT;
+      const auto slot  = static_cast<std::uint64_t>(list % cSLOT_COUNT);
+      if (level > 0U)
+      {
+         const auto shift      = cSLOT_BITS * (level + 1U);
+         const auto blockStart = ((mCurrentTick >> shift) << shift) | (slot << (cSLOT_BITS * level));
+         if (blockStart > targetTick)
+         {
+            break;
+         }
+         Cascade(list);
+         continue;
+      }
+
+      const auto tick = ((mCurrentTick >> cSLOT_BITS) << cSLOT_BITS) | slot;
+      if (tick > targetTick)
+      {
+         break;
+      }
+      mCurrentTick = tick;
+
+      auto index = mHeads[list];
+      while (index != cNO_INDEX)
+      {
+         auto next = mNodes[index].mNext;
+         if (mNodes[index].mRecord.mTime <= aTime)
+         {
+            aRecords.push_back(mNodes[index].mRecord);
+            Unlink(index);
+            Release(index);
+         }
+         index = next;
+      }
+
+      // Records remaining in the slot are later than the time, as are the records of every later tick.
+      if (mHeads[list] != cNO_INDEX)
+      {
+         break;
+      }
+   }
+
+   std::sort(aRecords.begin() + static_cast<std::ptrdiff_t>(first),
+             aRecords.end(),
+             [](const Record& aLhs, const Record& aRhs)
+             {
+                return (aLhs.mTime < aRhs.mTime) || ((aLhs.mTime == aRhs.mTime) && (aLhs.mSequence < aRhs.mSequence));
+             });
+}
+
+// =================================================================================================
+void TimingWheel::Compact(const std::function<void(const Record&, Handle)>& aRelocated)
+{
+   // Move the last pending record into the first free index until the pending records are contiguous.
+   Index first = 0U;
+   Index last  = static_cast<Index>(mNodes.size());
+   while (true)
+   {
+      while ((first < last) && mNodes[first].mActive)
+      {
+         ++first;
+      }
+      while ((last > first) && !mNodes[last - 1U].mActive)
+      {
+         --last;
+      }
+      if (first >= last)
+      {
+         break;
+      }
+
+      --last;
+      auto& node = mNodes[first];
+      node       = mNodes[last];
+      if (node.mPrevious != cNO_INDEX)
+      {
+         mNodes[node.mPrevious].mNext = first;
+      }
+      else
+      {
+         mHeads[node.mList] = first;
+      }
+      if (node.mNext != cNO_INDEX)
+      {
+         mNodes[node.mNext].mPrevious = first;
+      }
+      mNodes[last].mActive = false;
+
+      auto previousHandle  = node.mRecord.mHandle;
+      node.mRecord.mHandle = MakeHandle(first, node.mRecord.mSequence);
+      if (aRelocated)
+      {
+         aRelocated(node.mRecord, previousHandle);
+      }
+   }
+
+   mNodes.resize(mSize);
+   mNodes.shrink_to_fit();
+   mFreeIndices.clear();
+   mFreeIndices.shrink_to_fit();
+}
+
+// =================================================================================================
+TimingWheel::Handle TimingWheel::MakeHandle(Index aIndex, std::uint64_t aSequence)
+{
+   return (static_cast<Handle>(static_cast<std::uint32_t>(aSequence)) << 32U) | aIndex;
+}
+
+// =================================================================================================
+TimingWheel::Index TimingWheel::GetIndex(Handle aHandle) const
+{
+   auto index = static_cast<Index>(aHandle);
+   if ((index < mNodes.size()) && mNodes[index].mActive && (mNodes[index].mRecord.mHandle == aHandle))
+   {
+      return index;
+   }
+   return cNO_INDEX;
+}
+
+// =================================================================================================
+std::uint64_t TimingWheel::GetTick(double aTime) const
+{
+   const auto ticks = aTime / mTickSize;
+   if (!(ticks > 0.0))
+   {
+      return 0U;
+   }
+   if (ticks >= static_cast<double>(std::numeric_limits<std::uint64_t>::max()))
+   {
+      return std::numeric_limits<std::uint64_t>::max();
+   }
+   return static_cast<std::uint64_t>(ticks);
+}
+
+// =================================================================================================
+void TimingWheel::Place(Index aIndex)
+{
+   // Records are never placed before the current tick, so a late insertion is due on the next pop.
+   const auto tick = std::max(mNodes[aIndex].mTick, mCurrentTick);
+   for (size_t level = 0U; level < cLEVEL_COUNT; ++level)
+   {
+      const auto shift = cSLOT_BITS * (level + 1U);
+      if ((tick >> shift) == (mCurrentTick >> shift))
+      {
+         Link(aIndex, (level * cSLOT_COUNT) + static_cast<size_t>((tick >> (cSLOT_BITS * level)) % cSLOT_COUNT));
+         return;
+      }
+   }
+   Link(aIndex, cOVERFLOW_LIST);
+}
+
+// =================================================================================================
+void TimingWheel::Link(Index aIndex, size_t aList)
+{
+   auto& node     = mNodes[aIndex];
+   node.mList     = static_cast<std::uint16_t>(aList);
+   node.mPrevious = cNO_INDEX;
+   node.mNext     = mHeads[aList];
+   if (node.mNext != cNO_INDEX)
+   {
+      mNodes[node.mNext].mPrevious = aIndex;
+   }
+   mHeads[aList] = aIndex;
+
+   if (aList != cOVERFLOW_LIST)
+   {
+      const auto slot = aList % cSLOT_COUNT;
+      mOccupied[aList / cSLOT_COUNT][slot / 64U] |= (std::uint64_t{1} << (slot % 64U));
+   }
+}
+
+// =================================================================================================
+void TimingWheel::Unlink(Index aIndex)
+{
+   auto& node = mNodes[aIndex];
+   if (node.mPrevious != cNO_INDEX)
+   {
+      mNodes[node.mPrevious].mNext = node.mNext;
+   }
+   else
+   {
+      mHeads[node.mList] = node.mNext;
+   }
+   if (node.mNext != cNO_INDEX)
+   {
+      mNodes[node.mNext].mPrevious = node.mPrevious;
+   }
+
+   if ((node.mList != cOVERFLOW_LIST) && (mHeads[node.mList] == cNO_INDEX))
+   {
+      const auto slot = node.mList % cSLOT_COUNT;
+      mOccupied[node.mList / cSLOT_COUNT][slot / 64U] &= ~(std::uint64_t{1} << (slot % 64U));
+   }
+}
+
+// =================================================================================================
+void TimingWheel::Release(Index aIndex)
+{
+   mNodes[aIndex].mActive = false;
+   mFreeIndices.push_back(aIndex);
+   --mSize;
+}
+
+// =================================================================================================
+size_t TimingWheel::FindSlot(size_t aLevel, size_t aFirstSlot) const
+{
+   for (auto word = aFirstSlot / 64U; word < cWORD_COUNT; ++word)
+   {
+      auto bits = mOccupied[aLevel][word];
+      if (word == aFirstSlot / 64U)
+      {
+         bits &= (~std::uint64_t{0}) << (aFirstSlot % 64U);
+      }
+      if (bits != 0U)
+      {
+         return (aLevel * cSLOT_COUNT) + (word * 64U) + GetLowestBit(bits);
+      }
+   }
+   return cOVERFLOW_LIST;
+}
+
+// =================================================================================================
+size_t TimingWheel::FindEarliestList() const
+{
+   // Slots before the digit of the current tick are empty, as is the slot of the digit itself at
+   // the upper levels (its records having been cascaded when the wheel entered it).
+   for (size_t level = 0U; level < cLEVEL_COUNT; ++level)
+   {
+      auto firstSlot = static_cast<size_t>((mCurrentTick >> (cSLOT_BITS * level)) % cSLOT_COUNT);
+      if (level > 0U)
+      {
+         ++firstSlot;
+      }
+      if (firstSlot < cSLOT_COUNT)
+      {
+         auto list = FindSlot(level, firstSlot);
+         if (list != cOVERFLOW_LIST)
+         {
+            return list;
+         }
+      }
+   }
+   return cOVERFLOW_LIST;
+}
+
+// =================================================================================================
+void TimingWheel::Cascade(size_t aList)
+{
+   const auto level = aList / cSLOT_COUNT;
+   const auto slot  = static_cast<std::uint64_t>(aList % cSLOT_COUNT);
+   const auto shift = cSLOT_BITS * (level + 1U);
+   mCurrentTick     = ((mCurrentTick >> shift) << shift) | (slot << (cSLOT_BITS * level));
+
+   auto index    = mHeads[aList];
+   mHeads[aList] = cNO_INDEX;
+   mOccupied[level][slot / 64U] &= ~(std::uint64_t{1} << (slot % 64U));
+   while (index != cNO_INDEX)
+   {
+      auto next = mNodes[index].mNext;
+      Place(index);
+      index = next;
+   }
+}
+
+} // namespace cyber
+} // namespace wsf
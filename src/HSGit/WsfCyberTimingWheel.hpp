@@ -0,0 +1,159 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERTIMINGWHEEL_HPP
+#define WSFCYBERTIMINGWHEEL_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace wsf
+{
+namespace cyber
+{
+
+//! A hierarchical timing wheel of compact delay records, for the cyber engagement delays.
+//!
+//! Time is divided into ticks of a fixed size. The wheel has four levels of 256 slots, where a slot
+//! at level N spans 256^N ticks, and records beyond the range of the wheel are held in an overflow
+//! list. Each record is placed in the slot of its tick at the lowest level able to represent it,
+//! and is moved to lower levels (cascaded) as the wheel advances. Insertion and cancellation are
+//! constant time, using intrusive lists of records in a single pool.
+//!
+//! Record times are not rounded to the tick. Ticks only determine the slot of a record, and records
+//! are provided in order of their exact times (ties in order of insertion).
+//!
+//! Handles combine the pool index of a record with a generation (the low 32 bits of its insertion
+//! sequence), such that a handle to a removed record is not mistaken for a later record reusing its
+//! index. Removal is immediate, and Compact() returns the pool memory left by mass cancellation.
+class WSF_CYBER_EXPORT TimingWheel
+{
+public:
+   using Handle = std::uint64_t;
+
+   static constexpr Handle cNO_HANDLE        = std::numeric_limits<Handle>::max();
+   static constexpr double cDEFAULT_TICK_SIZE = 0.001;
+
+   struct Record
+   {
+      double        mTime;
+      std::uint64_t mSequence;
+      size_t        mVictimId;
+      size_t        mKey;
+      Handle        mHandle;
+      std::uint8_t  mType;
+   };
+
+   explicit TimingWheel(double aTickSize = cDEFAULT_TICK_SIZE);
+   ~TimingWheel()                       = default;
+   TimingWheel(const TimingWheel& aSrc) = delete;
+   TimingWheel& operator=(const TimingWheel& aRhs) = delete;
+   TimingWheel(TimingWheel&& aSrc)                 = default;
+   TimingWheel& operator=(TimingWheel&& aRhs) = default;
+
+   //! Adds a record, returning its handle. The time must not precede the time of the last call
+   //! to PopDue().
+   Handle Insert(double aTime, std::uint8_t aType, size_t aVictimId, size_t aKey);
+
+   //! Removes the record, returning false if the handle does not refer to a pending record.
+   bool Cancel(Handle aHandle);
+
+   //! Returns true if the handle refers to a pending record.
+   bool Contains(Handle aHandle) const;
+
+   //! Returns the earliest time of any pending record, or the maximum double if none exist.
+   double GetNextTime() const;
+
+   //! Removes every record at or before the time, appending them to the records provided in order
+   //! of time.
+   void PopDue(double aTime, std::vector<Record>& aRecords);
+
+   //! Moves the pending records to the front of the pool and releases the remainder of the pool.
+   //! Each record that is moved is provided to the function with its new handle, along with its
+   //! previous handle, which is no longer valid.
+   void Compact(const std::function<void(const Record&, Handle)>& aRelocated);
+
+   size_t GetSize() const { return mSize; }
+   size_t GetCapacity() const { return mNodes.size(); }
+   bool   IsEmpty() const { return (mSize == 0U); }
+   double GetTickSize() const { return mTickSize; }
+
+private:
+   static constexpr unsigned int cSLOT_BITS   = 8U;
+   static constexpr size_t       cSLOT_COUNT  = 1U << cSLOT_BITS;
+   static constexpr size_t       cLEVEL_COUNT = 4U;
+   static constexpr size_t       cWORD_COUNT  = cSLOT_COUNT / 64U;
+
+   //! The list index of the overflow list, following the lists of each slot of each level.
+   static constexpr size_t cOVERFLOW_LIST = cLEVEL_COUNT * cSLOT_COUNT;
+
+   //! The occupancy of the slots of a level, one bit per slot.
+   using Bitmap = std::array<std::uint64_t, cWORD_COUNT>;
+
+   //! The index of a record in the pool.
+   using Index = std::uint32_t;
+
+   static constexpr Index cNO_INDEX = std::numeric_limits<Index>::max();
+
+   struct Node
+   {
+      Record        mRecord;
+      std::uint64_t mTick;
+      Index         mNext;
+      Index         mPrevious;
+      std::uint16_t mList;
+      bool          mActive;
+   };
+
+   static Handle MakeHandle(Index aIndex, std::uint64_t aSequence);
+
+   //! Returns the index of the pending record of the handle, or cNO_INDEX if none exists.
+   Index GetIndex(Handle aHandle) const;
+
+   std::uint64_t GetTick(double aTime) const;
+
+   void Place(Index aIndex);
+   void Link(Index aIndex, size_t aList);
+   void Unlink(Index aIndex);
+   void Release(Index aIndex);
+
+   //! Returns the list of the first occupied slot at or after the digit of the current tick at
+   //! the level, within the current block of the level above, or cOVERFLOW_LIST if none exist.
+   size_t FindSlot(size_t aLevel, size_t aFirstSlot) const;
+
+   //! Returns the list containing the earliest pending records, or cOVERFLOW_LIST if the wheel
+   //! is empty (in which case only the overflow list may contain records).
+   size_t FindEarliestList() const;
+
+   //! Advances the current tick to the start of the slot, and places its records at lower levels.
+   void Cascade(size_t aList);
+
+   double                                 mTickSize;
+   std::uint64_t                          mCurrentTick{0U};
+   std::uint64_t                          mSequence{0U};
+   size_t                                 mSize{0U};
+   std::vector<Node>                      mNodes;
+   std::vector<Index>                     mFreeIndices;
+   std::array<Index, cOVERFLOW_LIST + 1U> mHeads;
+   std::array<Bitmap, cLEVEL_COUNT>       mOccupied{};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
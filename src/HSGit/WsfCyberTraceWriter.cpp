@@ -0,0 +1,270 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberTraceWriter.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+#include "WsfCyberEngagement.hpp"
+#include "WsfSimulation.hpp"
+
+namespace
+{
+//! The trace process identifiers of each timeline.
+constexpr int cWALL_TIME_PID = 1;
+constexpr int cSIM_TIME_PID  = 2;
+
+std::string Escape(const std::string& aText)
+{
+   std::string escaped;
+   escaped.reserve(aText.size());
+   for (auto character : aText)
+   {
+      if ((character == '"') || (character == '\\'))
+      {
+         escaped += '\\';
+      }
+      escaped += character;
+   }
+   return escaped;
+}
+} // namespace
+
+namespace wsf
+{
+namespace cyber
+{
+
+constexpr size_t TraceWriter::cDEFAULT_CAPACITY;
+
+// =================================================================================================
+TraceWriter::Scope::Scope(TraceWriter* aWriterPtr, const char* aHandler, const Engagement& aEngagement, bool aScan)
+   : mWriterPtr(aWriterPtr)
+   , mHandler(aHandler)
+   , mEngagement(aEngagement)
+   , mScan(aScan)
+{
+   if (mWriterPtr)
+   {
+      mSimTime = mEngagement.GetSimulation().GetSimTime();
+      mWriterPtr->MarkHandler(mHandler, mEngagement, mScan, mSimTime);
+      mStart = Clock::now();
+   }
+}
+
+// =================================================================================================
+TraceWriter::Scope::~Scope()
+{
+   if (mWriterPtr)
+   {
+      mWriterPtr->AddHandler(mHandler, mEngagement, mScan, mSimTime, mStart, Clock::now());
+   }
+}
+
+// =================================================================================================
+TraceWriter::TraceWriter(const std::string& aFileName, size_t aCapacity) // = cDEFAULT_CAPACITY
+   : mStream(aFileName)
+   , mStartTime(Clock::now())
+   , mCapacity(std::max<size_t>(aCapacity, 1U))
+{
+   if (!mStream)
+   {
+      mStopping = true;
+      return;
+   }
+
+   mBuffer.reserve(mCapacity);
+   mPending.reserve(mCapacity);
+
+   mStream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+   WriteEvent("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(cWALL_TIME_PID) +
+              ",\"args\":{\"name\":\"Cyber handlers (wall time)\"}}");
+   WriteEvent("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(cSIM_TIME_PID) +
+              ",\"args\":{\"name\":\"Cyber engagements (simulation time)\"}}");
+
+   mThread = std::thread(&TraceWriter::Run, this);
+}
+
+// =================================================================================================
+TraceWriter::~TraceWriter()
+{
+   Close();
+}
+
+// =================================================================================================
+void TraceWriter::BeginAttempt(const Engagement& aEngagement, bool aScan, double aSimTime)
+{
+   auto label = aEngagement.GetAttackType() + ": " + aEngagement.GetAttacker() + " -> " + aEngagement.GetVictim();
+   Append(Record{'b', aScan, aScan ? "scan" : "attack", aEngagement.GetKey(), aSimTime, 0.0, 0.0, std::move(label)});
+}
+
+// =================================================================================================
+void TraceWriter::EndAttempt(const Engagement& aEngagement, bool aScan, double aSimTime)
+{
+   Append(Record{'e', aScan, aScan ? "scan" : "attack", aEngagement.GetKey(), aSimTime, 0.0, 0.0, std::string()});
+}
+
+// =================================================================================================
+void TraceWriter::MarkHandler(const char* aHandler, const Engagement& aEngagement, bool aScan, double aSimTime)
+{
+   Append(Record{'n', aScan, aHandler, aEngagement.GetKey(), aSimTime, 0.0, 0.0, std::string()});
+}
+
+// =================================================================================================
+void TraceWriter::AddHandler(const char*       aHandler,
+                             const Engagement& aEngagement,
+                             bool              aScan,
+                             double            aSimTime,
+                             Clock::time_point aStart,
+                             Clock::time_point aEnd)
+{
+   double wallStart    = GetWallTime(aStart);
+   double wallDuration = GetWallTime(aEnd) - wallStart;
+   Append(Record{'X', aScan, aHandler, aEngagement.GetKey(), aSimTime, wallStart, wallDuration, std::string()});
+}
+
+// =================================================================================================
+void TraceWriter::Flush()
+{
+   std::unique_lock<std::mutex> lock(mMutex);
+   if (!mThread.joinable())
+   {
+      return;
+   }
+
+   mWrittenCondition.wait(lock, [this]() { return mPending.empty(); });
+   mPending.swap(mBuffer);
+   mPendingCondition.notify_one();
+}
+
+// =================================================================================================
+void TraceWriter::Close()
+{
+   if (!mThread.joinable())
+   {
+      return;
+   }
+
+   Flush();
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStopping = true;
+   }
+   mPendingCondition.notify_one();
+   mThread.join();
+
+   mStream << "\n]}\n";
+   mStream.close();
+}
+
+// =================================================================================================
+size_t TraceWriter::GetDroppedCount() const
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   return mDroppedCount;
+}
+
+// =================================================================================================
+void TraceWriter::Append(Record&& aRecord)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   if (mStopping)
+   {
+      return;
+   }
+
+   if (mBuffer.size() >= mCapacity)
+   {
+      //! The pending buffer is only modified by the background thread while it is non-empty.
+      if (!mPending.empty())
+      {
+         ++mDroppedCount;
+         return;
+      }
+      mPending.swap(mBuffer);
+      mPendingCondition.notify_one();
+   }
+   mBuffer.push_back(std::move(aRecord));
+}
+
+// =================================================================================================
+void TraceWriter::Run()
+{
+   std::unique_lock<std::mutex> lock(mMutex);
+   while (true)
+   {
+      mPendingCondition.wait(lock, [this]() { return !mPending.empty() || mStopping; });
+      if (mPending.empty())
+      {
+         return;
+      }
+
+      lock.unlock();
+      Write(mPending);
+      lock.lock();
+
+      mPending.clear();
+      mWrittenCondition.notify_all();
+   }
+}
+
+// =================================================================================================
+void TraceWriter::Write(const std::vector<Record>& aRecords)
+{
+   //! Engagement keys are written as strings, as they exceed the precision of JSON numbers.
+   std::ostringstream event;
+   event << std::fixed << std::setprecision(3);
+   for (const auto& record : aRecords)
+   {
+      const char* category = record.mScan ? "scan" : "attack";
+      double      simTime  = record.mSimTime * 1.0E6;
+
+      event.str(std::string());
+      if (record.mPhase == 'X')
+      {
+         event << "{\"name\":\"" << record.mName << "\",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":"
+               << cWALL_TIME_PID << ",\"tid\":1,\"ts\":" << record.mWallStart << ",\"dur\":" << record.mWallDuration
+               << ",\"args\":{\"engagement\":\"" << record.mKey << "\",\"sim_time\":" << record.mSimTime << "}}";
+      }
+      else
+      {
+         event << "{\"name\":\"" << record.mName << "\",\"cat\":\"" << category << "\",\"ph\":\"" << record.mPhase
+               << "\",\"id\":\"" << record.mKey << "\",\"pid\":" << cSIM_TIME_PID << ",\"tid\":1,\"ts\":" << simTime;
+         if (!record.mLabel.empty())
+         {
+            event << ",\"args\":{\"engagement\":\"" << Escape(record.mLabel) << "\"}";
+         }
+         event << "}";
+      }
+      WriteEvent(event.str());
+   }
+   mStream.flush();
+}
+
+// =================================================================================================
+void TraceWriter::WriteEvent(const std::string& aEvent)
+{
+   mStream << (mFirstEvent ? "\n" : ",\n") << aEvent;
+   mFirstEvent = false;
+}
+
+// =================================================================================================
+double TraceWriter::GetWallTime(Clock::time_point aTime) const
+{
+   return std::chrono::duration<double, std::micro>(aTime - mStartTime).count();
+}
+
+} // namespace cyber
+} // namespace wsf
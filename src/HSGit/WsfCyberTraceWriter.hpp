@@ -0,0 +1,137 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERTRACEWRITER_HPP
+#define WSFCYBERTRACEWRITER_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace wsf
+{
+namespace cyber
+{
+class Engagement;
+
+//! Writes the progression of engagements as a Chrome trace (JSON object format), viewable in
+//! chrome://tracing or Perfetto. Two timelines are written:
+//! - Handler execution in wall clock time, as a span for each engagement handler.
+//!   This identifies the engagements and handlers that stall the event loop.
+//! - Scan and attack attempts in simulation time, as an asynchronous span for each attempt
+//!   from its initiation to its completion, marked at each handler. This identifies the
+//!   engagements whose delays accumulate.
+//!
+//! Records are buffered in memory, and written by a background thread whenever the buffer fills.
+//! Memory use is bounded by two buffers of the capacity provided. If both buffers are full,
+//! records are dropped (see GetDroppedCount()) rather than delaying the simulation.
+class WSF_CYBER_EXPORT TraceWriter
+{
+public:
+   using Clock = std::chrono::steady_clock;
+
+   static constexpr size_t cDEFAULT_CAPACITY = 65536U;
+
+   //! Records a handler, if a writer is provided. The handler is marked on the simulation time span
+   //! of its scan or attack attempt upon construction, and its wall time is recorded upon destruction.
+   class Scope
+   {
+   public:
+      Scope(TraceWriter* aWriterPtr, const char* aHandler, const Engagement& aEngagement, bool aScan);
+      ~Scope();
+      Scope(const Scope& aSrc) = delete;
+      Scope& operator=(const Scope& aRhs) = delete;
+
+   private:
+      TraceWriter*      mWriterPtr;
+      const char*       mHandler;
+      const Engagement& mEngagement;
+      bool              mScan;
+      double            mSimTime{0.0};
+      Clock::time_point mStart;
+   };
+
+   //! Opens the file and starts the background writer. Use IsOpen() to check for success.
+   explicit TraceWriter(const std::string& aFileName, size_t aCapacity = cDEFAULT_CAPACITY);
+   ~TraceWriter();
+   TraceWriter(const TraceWriter& aSrc) = delete;
+   TraceWriter& operator=(const TraceWriter& aRhs) = delete;
+
+   bool IsOpen() const { return mThread.joinable(); }
+
+   //! @name Recording methods
+   //@{
+   void BeginAttempt(const Engagement& aEngagement, bool aScan, double aSimTime);
+   void EndAttempt(const Engagement& aEngagement, bool aScan, double aSimTime);
+   void MarkHandler(const char* aHandler, const Engagement& aEngagement, bool aScan, double aSimTime);
+   void AddHandler(const char*       aHandler,
+                   const Engagement& aEngagement,
+                   bool              aScan,
+                   double            aSimTime,
+                   Clock::time_point aStart,
+                   Clock::time_point aEnd);
+   //@}
+
+   //! Queues the buffered records for writing, waiting for any previous write to complete.
+   void Flush();
+
+   //! Writes every buffered record and closes the file. The trace is incomplete until closed.
+   void Close();
+
+   size_t GetDroppedCount() const;
+
+private:
+   struct Record
+   {
+      char        mPhase; //!< The Chrome trace event phase: 'X' (handler), 'b', 'n' or 'e' (attempt).
+      bool        mScan;
+      const char* mName;
+      size_t      mKey;
+      double      mSimTime;
+      double      mWallStart;
+      double      mWallDuration;
+      std::string mLabel; //!< The attack type, attacker and victim, for the beginning of an attempt.
+   };
+
+   void Append(Record&& aRecord);
+   void Run();
+   void Write(const std::vector<Record>& aRecords);
+   void WriteEvent(const std::string& aEvent);
+
+   double GetWallTime(Clock::time_point aTime) const;
+
+   std::ofstream     mStream;
+   Clock::time_point mStartTime;
+   size_t            mCapacity;
+   bool              mFirstEvent{true};
+
+   mutable std::mutex      mMutex;
+   std::condition_variable mPendingCondition;
+   std::condition_variable mWrittenCondition;
+   std::vector<Record>     mBuffer;
+   std::vector<Record>     mPending;
+   size_t                  mDroppedCount{0U};
+   bool                    mStopping{false};
+   std::thread             mThread;
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
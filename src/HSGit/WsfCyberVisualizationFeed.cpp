@@ -0,0 +1,165 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#include "WsfCyberVisualizationFeed.hpp"
+
+#include "WsfCyberEngagement.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+
+constexpr std::uint8_t VisualizationFeed::cNO_STATE;
+
+// =================================================================================================
+VisualizationFeed::VisualizationFeed(const Sink&      aSink,
+                                     Window           aWindowType,
+                                     double           aWindow,
+                                     const Scheduler& aScheduler) // = nullptr
+   : mSink(aSink)
+   , mWindowType(aWindowType)
+   , mWindow(aWindow)
+   , mScheduler(aScheduler)
+   , mWindowWallTime(std::chrono::steady_clock::now())
+{
+}
+
+// =================================================================================================
+void VisualizationFeed::Post(ObserverRecord::Type aState, Engagement& aEngagement, double aSimTime)
+{
+   ++mPostedCount;
+   if (mPending.empty())
+   {
+      StartWindow(aSimTime);
+   }
+
+   bool scan   = ((aState == ObserverRecord::cSCAN_INITIATED) || (aState == ObserverRecord::cSCAN_SUCCEEDED) ||
+                (aState == ObserverRecord::cSCAN_FAILED));
+   auto key    = aEngagement.GetKey();
+   auto result = mPendingIndex.Emplace(key, mPending.size());
+   if (result.second)
+   {
+      mPending.push_back(Pending{key, &aEngagement, cNO_STATE, cNO_STATE, scan});
+   }
+
+   auto& pending = mPending[*result.first];
+   (scan ? pending.mScanState : pending.mAttackState) = static_cast<std::uint8_t>(aState);
+   pending.mScanLast                                   = scan;
+
+   if (IsWindowEnded(aSimTime))
+   {
+      Flush();
+   }
+}
+
+// =================================================================================================
+void VisualizationFeed::Remove(size_t aKey)
+{
+   auto indexPtr = mPendingIndex.Find(aKey);
+   if (indexPtr)
+   {
+      //! Send the final states, and clear the entry rather than shifting the remaining entries.
+      auto& pending = mPending[*indexPtr];
+      Send(pending);
+      pending.mAttackState = cNO_STATE;
+      pending.mScanState   = cNO_STATE;
+      mPendingIndex.Erase(aKey);
+   }
+   mSent.Erase(aKey);
+}
+
+// =================================================================================================
+void VisualizationFeed::Update(double aSimTime)
+{
+   if (!mPending.empty() && IsWindowEnded(aSimTime))
+   {
+      Flush();
+   }
+}
+
+// =================================================================================================
+void VisualizationFeed::Flush()
+{
+   if (mPending.empty())
+   {
+      return;
+   }
+
+   ++mBatchCount;
+   for (const auto& pending : mPending)
+   {
+      Send(pending);
+   }
+   mPending.clear();
+   mPendingIndex.Clear();
+}
+
+// =================================================================================================
+bool VisualizationFeed::IsWindowEnded(double aSimTime) const
+{
+   if (mWindowType == Window::cSIM_TIME)
+   {
+      return (aSimTime - mWindowSimTime) >= mWindow;
+   }
+   return std::chrono::duration<double>(std::chrono::steady_clock::now() - mWindowWallTime).count() >= mWindow;
+}
+
+// =================================================================================================
+void VisualizationFeed::StartWindow(double aSimTime)
+{
+   mWindowSimTime = aSimTime;
+   if (mWindowType == Window::cWALL_TIME)
+   {
+      mWindowWallTime = std::chrono::steady_clock::now();
+   }
+   else if (mScheduler && (mWindow > 0.0))
+   {
+      mScheduler(aSimTime + mWindow);
+   }
+}
+
+// =================================================================================================
+void VisualizationFeed::Send(const Pending& aPending)
+{
+   if ((aPending.mAttackState == cNO_STATE) && (aPending.mScanState == cNO_STATE))
+   {
+      return;
+   }
+
+   auto& sent       = *mSent.Emplace(aPending.mKey, Sent{cNO_STATE, cNO_STATE}).first;
+   auto& engagement = *aPending.mEngagementPtr;
+   if (aPending.mScanLast)
+   {
+      SendState(aPending.mAttackState, sent.mAttackState, engagement);
+      SendState(aPending.mScanState, sent.mScanState, engagement);
+   }
+   else
+   {
+      SendState(aPending.mScanState, sent.mScanState, engagement);
+      SendState(aPending.mAttackState, sent.mAttackState, engagement);
+   }
+}
+
+// =================================================================================================
+void VisualizationFeed::SendState(std::uint8_t aState, std::uint8_t& aSentState, Engagement& aEngagement)
+{
+   if ((aState != cNO_STATE) && (aState != aSentState))
+   {
+      aSentState = aState;
+      mSink(static_cast<ObserverRecord::Type>(aState), aEngagement);
+      ++mSentCount;
+   }
+}
+
+} // namespace cyber
+} // namespace wsf
@@ -0,0 +1,127 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+#ifndef WSFCYBERVISUALIZATIONFEED_HPP
+#define WSFCYBERVISUALIZATIONFEED_HPP
+
+#include "wsf_cyber_export.h"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "WsfCyberFlatMap.hpp"
+#include "WsfCyberObserverDispatcher.hpp"
+
+namespace wsf
+{
+namespace cyber
+{
+class Engagement;
+
+//! A coalescing layer for the visualization of engagements. Attack and scan state changes
+//! (initiated, succeeded, failed) are held for a window of simulation or wall clock time, and only
+//! the latest attack state and latest scan state of each engagement is sent when the window ends.
+//! States are delta compressed: a state is not sent if it matches the state last sent for the
+//! engagement.
+//!
+//! Engagements are sent in the order of their first change within the window. For each engagement,
+//! the attack and scan states are sent in the order of their latest change, such that the order of
+//! the states received for any single engagement matches the order of the changes.
+//! A window of zero sends every change immediately.
+//!
+//! A window otherwise ends upon the first change or Update() following its end. Update() should be
+//! called as time advances, such that the held states are not delayed until a subsequent change.
+//! If a scheduler is provided, it is requested to call Update() at the end of each simulation time window.
+class WSF_CYBER_EXPORT VisualizationFeed
+{
+public:
+   enum class Window
+   {
+      cSIM_TIME,
+      cWALL_TIME
+   };
+
+   //! Sends a state to the visualization.
+   using Sink = std::function<void(ObserverRecord::Type aState, Engagement& aEngagement)>;
+
+   //! Requests a call to Update() at the simulation time provided.
+   using Scheduler = std::function<void(double aSimTime)>;
+
+   VisualizationFeed(const Sink& aSink, Window aWindowType, double aWindow, const Scheduler& aScheduler = nullptr);
+   ~VisualizationFeed()                             = default;
+   VisualizationFeed(const VisualizationFeed& aSrc) = delete;
+   VisualizationFeed& operator=(const VisualizationFeed& aRhs) = delete;
+
+   //! Records a state change of the engagement, sending the held states if the window has ended.
+   void Post(ObserverRecord::Type aState, Engagement& aEngagement, double aSimTime);
+
+   //! Sends the held states of the engagement, and forgets the engagement.
+   //! Must be called prior to the destruction or reuse of an engagement.
+   void Remove(size_t aKey);
+
+   //! Sends the held states if the window has ended.
+   void Update(double aSimTime);
+
+   //! Sends every held state, and begins a new window.
+   void Flush();
+
+   size_t GetPostedCount() const { return mPostedCount; }
+   size_t GetSentCount() const { return mSentCount; }
+   size_t GetBatchCount() const { return mBatchCount; }
+
+private:
+   static constexpr std::uint8_t cNO_STATE = 0xFFU;
+
+   struct Pending
+   {
+      size_t       mKey;
+      Engagement*  mEngagementPtr;
+      std::uint8_t mAttackState;
+      std::uint8_t mScanState;
+      bool         mScanLast;
+   };
+
+   struct Sent
+   {
+      std::uint8_t mAttackState;
+      std::uint8_t mScanState;
+   };
+
+   bool IsWindowEnded(double aSimTime) const;
+   void StartWindow(double aSimTime);
+   void Send(const Pending& aPending);
+   void SendState(std::uint8_t aState, std::uint8_t& aSentState, Engagement& aEngagement);
+
+   Sink      mSink;
+   Window    mWindowType;
+   double    mWindow;
+   Scheduler mScheduler;
+
+   double                                mWindowSimTime{0.0};
+   std::chrono::steady_clock::time_point mWindowWallTime;
+
+   //! The held states, in order of their first change within the window, and their index by key.
+   std::vector<Pending> mPending;
+   FlatMap<size_t>      mPendingIndex;
+   FlatMap<Sent>        mSent;
+
+   size_t mPostedCount{0U};
+   size_t mSentCount{0U};
+   size_t mBatchCount{0U};
+};
+
+} // namespace cyber
+} // namespace wsf
+
+#endif
@@ -0,0 +1,1092 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+
+//! Microbenchmarks of the hot operations of the cyber engagement subsystem.
+//!
+//! Usage: wsf_cyber_benchmark [--max-size N] [--repetitions N] [--output FILE]
+//!
+//! Each case is run at 10^2, 10^4 and 10^6 engagements (up to the maximum size), and the fastest
+//! of the repetitions is reported. Results are written as JSON to the output file, or to standard
+//! output if no file is provided, such that they may be compared between builds.
+//!
+//! The engagement cases use the EngagementManager of a stand-in simulation, created from a scenario
+//! defining only the attack types and the platforms engaged (see StandInSimulation). The event
+//! manager cases use the EventManager itself, hosted by a stand-in for the simulation event queue.
+//! Cases comparing against a previous implementation (FindEngagementHashedKey against
+//! FindEngagement, and ResourceCheckScenarioLookup against ResourceCheckResolved) reproduce that
+//! implementation, as it is no longer part of the subsystem.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "UtMemory.hpp"
+#include "WsfApplication.hpp"
+#include "WsfCyberConstraint.hpp"
+#include "WsfCyberEngagementKernel.hpp"
+#include "WsfCyberEngagementManager.hpp"
+#include "WsfCyberEvent.hpp"
+#include "WsfCyberEventManager.hpp"
+#include "WsfCyberInterner.hpp"
+#include "WsfCyberStandaloneHost.hpp"
+#include "WsfCyberTimingWheel.hpp"
+#include "WsfEventStepSimulation.hpp"
+#include "WsfScenario.hpp"
+#include "WsfStandardApplication.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+//! The time taken to perform a number of operations, and the peak size of the queue of the
+//! operations (for the cases with a queue).
+struct Sample
+{
+   double      mSeconds;
+   std::size_t mOperations;
+   std::size_t mPeakQueueSize{0U};
+};
+
+struct Result
+{
+   std::string mName;
+   std::size_t mSize;
+   Sample      mSample;
+};
+
+//! A benchmark case performs its own (untimed) setup for the number of engagements provided,
+//! and returns the time taken by the operations of interest.
+using Case = std::function<Sample(std::size_t)>;
+
+double GetSeconds(Clock::time_point aStart)
+{
+   return std::chrono::duration<double>(Clock::now() - aStart).count();
+}
+
+//! Prevents the optimizer from discarding an unused result.
+volatile std::size_t sSink = 0U;
+
+// =================================================================================================
+// Engagements. The EngagementManager of a stand-in simulation, engaging stand-in platforms.
+// =================================================================================================
+
+//! The number of attack types defined by the stand-in scenario.
+constexpr std::size_t cATTACK_TYPE_COUNT = 4U;
+
+//! The scenario input of the stand-in simulation, written for the duration of the scenario load.
+const char* const cINPUT_FILE_NAME = "wsf_cyber_benchmark_input.txt";
+
+std::string GetAttackTypeName(std::size_t aIndex)
+{
+   return "BENCHMARK_ATTACK_" + std::to_string(aIndex);
+}
+
+std::string GetPlatformName(std::size_t aIndex)
+{
+   return "benchmark_platform_" + std::to_string(aIndex);
+}
+
+//! Each platform attacks every other platform with every attack type, such that the number of
+//! platforms required grows with the square root of the number of engagements.
+std::size_t GetPlatformCount(std::size_t aSize)
+{
+   std::size_t platformCount = 2U;
+   while (platformCount * (platformCount - 1U) * cATTACK_TYPE_COUNT < aSize)
+   {
+      ++platformCount;
+   }
+   return platformCount;
+}
+
+//! The attack type, attacker and victim of an engagement, by index.
+struct EngagementIndices
+{
+   std::size_t mAttackType;
+   std::size_t mAttacker;
+   std::size_t mVictim;
+};
+
+EngagementIndices GetEngagementIndices(std::size_t aIndex, std::size_t aPlatformCount)
+{
+   auto pairIndex = aIndex / cATTACK_TYPE_COUNT;
+   auto attacker  = pairIndex / (aPlatformCount - 1U);
+   auto victim    = (attacker + 1U + pairIndex % (aPlatformCount - 1U)) % aPlatformCount;
+   return EngagementIndices{aIndex % cATTACK_TYPE_COUNT, attacker, victim};
+}
+
+//! A simulation of a scenario defining only the attack types and platforms of the engagements. The
+//! attack types have no effects, and each victim uses the default protection provided to every platform.
+//! The attack types of a delayed simulation delay the delivery of each attack, such that every attack
+//! is continued by a scheduled event. Scans are never delayed.
+class StandInSimulation
+{
+public:
+   //! The identifiers of an engagement, as interned by the engagement manager.
+   struct EngagementIds
+   {
+      wsf::cyber::Interner::Id mAttackTypeId;
+      wsf::cyber::Interner::Id mAttackerId;
+      wsf::cyber::Interner::Id mVictimId;
+   };
+
+   StandInSimulation(WsfApplication& aApplication, std::size_t aSize, bool aDelayed = false);
+   ~StandInSimulation();
+   StandInSimulation(const StandInSimulation& aSrc) = delete;
+   StandInSimulation& operator=(const StandInSimulation& aRhs) = delete;
+
+   WsfSimulation&                  GetSimulation() { return *mSimulationPtr; }
+   wsf::cyber::EngagementManager&  GetManager() { return wsf::cyber::EngagementManager::Get(*mSimulationPtr); }
+   const EngagementIds&            GetEngagementIds(std::size_t aIndex) const { return mEngagementIds[aIndex]; }
+   const std::vector<std::size_t>& GetPlatformIds() const { return mPlatformIds; }
+
+   //! Adds every engagement via its first scan, returning the number of successful scans.
+   std::size_t Scan();
+
+   //! Executes every scheduled event, completing the simulation.
+   void Run();
+
+private:
+   WsfScenario                    mScenario;
+   std::unique_ptr<WsfSimulation> mSimulationPtr;
+   std::vector<EngagementIds>     mEngagementIds;
+   std::vector<std::size_t>       mPlatformIds;
+};
+
+// =================================================================================================
+StandInSimulation::StandInSimulation(WsfApplication& aApplication,
+                                     std::size_t     aSize,
+                                     bool            aDelayed) // = false
+   : mScenario(aApplication)
+{
+   auto platformCount = GetPlatformCount(aSize);
+   {
+      std::ofstream input(cINPUT_FILE_NAME);
+      input << "end_time 1 hour\n";
+      for (std::size_t i = 0U; i < cATTACK_TYPE_COUNT; ++i)
+      {
+         input << "cyber_attack " << GetAttackTypeName(i) << " WSF_CYBER_ATTACK\n";
+         if (aDelayed)
+         {
+            input << "   delivery_delay_time constant 1 s\n";
+         }
+         input << "end_cyber_attack\n";
+      }
+      for (std::size_t i = 0U; i < platformCount; ++i)
+      {
+         input << "platform " << GetPlatformName(i) << " WSF_PLATFORM\nend_platform\n";
+      }
+   }
+   mScenario.LoadFromFile(cINPUT_FILE_NAME);
+   std::remove(cINPUT_FILE_NAME);
+   mScenario.CompleteLoad();
+
+   mSimulationPtr = ut::make_unique<WsfEventStepSimulation>(mScenario, 1U);
+   if (!mSimulationPtr->Initialize())
+   {
+      throw std::runtime_error("Unable to initialize the benchmark simulation.");
+   }
+   mSimulationPtr->Start();
+
+   //! The names are interned prior to the cases, such that the cases use the identifier based methods.
+   auto&                                 manager = GetManager();
+   std::vector<wsf::cyber::Interner::Id> attackTypeIds;
+   for (std::size_t i = 0U; i < cATTACK_TYPE_COUNT; ++i)
+   {
+      attackTypeIds.push_back(manager.GetAttackTypeId(GetAttackTypeName(i), *mSimulationPtr));
+   }
+   for (std::size_t i = 0U; i < platformCount; ++i)
+   {
+      mPlatformIds.push_back(manager.GetPlatformId(GetPlatformName(i), *mSimulationPtr));
+   }
+   if ((std::count(attackTypeIds.begin(), attackTypeIds.end(), wsf::cyber::Interner::cNULL_ID) > 0) ||
+       (std::count(mPlatformIds.begin(), mPlatformIds.end(), wsf::cyber::Interner::cNULL_ID) > 0))
+   {
+      throw std::runtime_error("The benchmark simulation does not provide the attack types and platforms.");
+   }
+
+   mEngagementIds.reserve(aSize);
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      auto indices = GetEngagementIndices(i, platformCount);
+      mEngagementIds.push_back(EngagementIds{attackTypeIds[indices.mAttackType],
+                                             mPlatformIds[indices.mAttacker],
+                                             mPlatformIds[indices.mVictim]});
+   }
+}
+
+// =================================================================================================
+StandInSimulation::~StandInSimulation()
+{
+   if (mSimulationPtr->IsActive())
+   {
+      mSimulationPtr->Complete(mSimulationPtr->GetSimTime());
+   }
+}
+
+// =================================================================================================
+std::size_t StandInSimulation::Scan()
+{
+   auto&       manager = GetManager();
+   std::size_t scanned = 0U;
+   for (const auto& ids : mEngagementIds)
+   {
+      scanned += manager.CyberScan(ids.mAttackTypeId, ids.mAttackerId, ids.mVictimId, *mSimulationPtr) ? 1U : 0U;
+   }
+   return scanned;
+}
+
+// =================================================================================================
+void StandInSimulation::Run()
+{
+   while (mSimulationPtr->IsActive())
+   {
+      mSimulationPtr->AdvanceTime();
+   }
+   mSimulationPtr->Complete(mSimulationPtr->GetSimTime());
+}
+
+// =================================================================================================
+//! AddEngagement() is internal to the engagement manager, so engagements are added via their first
+//! scan. The cost of the scan alone is provided by CyberScan, which repeats the scan of every engagement.
+Sample AddEngagement(WsfApplication& aApplication, std::size_t aSize)
+{
+   StandInSimulation standIn(aApplication, aSize);
+
+   auto start   = Clock::now();
+   auto scanned = standIn.Scan();
+   auto seconds = GetSeconds(start);
+   sSink        = scanned;
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+Sample CyberScan(WsfApplication& aApplication, std::size_t aSize)
+{
+   StandInSimulation standIn(aApplication, aSize);
+   standIn.Scan();
+
+   auto start   = Clock::now();
+   auto scanned = standIn.Scan();
+   auto seconds = GetSeconds(start);
+   sSink        = scanned;
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+Sample FindEngagement(WsfApplication& aApplication, std::size_t aSize)
+{
+   StandInSimulation standIn(aApplication, aSize);
+   standIn.Scan();
+   auto& manager = standIn.GetManager();
+
+   //! Lookups are made in random order, as engagements are requested by scripts.
+   std::vector<std::size_t> order(aSize);
+   std::iota(order.begin(), order.end(), std::size_t{0U});
+   std::shuffle(order.begin(), order.end(), std::mt19937_64{1U});
+
+   std::size_t found = 0U;
+   auto        start = Clock::now();
+   for (auto i : order)
+   {
+      const auto& ids = standIn.GetEngagementIds(i);
+      found += (manager.FindEngagement(ids.mAttackTypeId, ids.mAttackerId, ids.mVictimId) != nullptr) ? 1U : 0U;
+   }
+   auto seconds = GetSeconds(start);
+   sSink        = found;
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+//! Approximates the footprint of an engagement and its effects.
+struct EngagementRecord
+{
+   std::size_t                   mKey;
+   std::array<std::uint8_t, 504> mData;
+};
+
+//! The previous engagement key, a combination of the hashes of the attack type and platform names.
+std::size_t GetHashedKey(const std::string& aAttackType, const std::string& aAttacker, const std::string& aVictim)
+{
+   auto hash = std::hash<std::string>{}(aAttackType);
+   hash ^= std::hash<std::string>{}(aAttacker) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+   hash ^= std::hash<std::string>{}(aVictim) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+   return hash;
+}
+
+// =================================================================================================
+//! FindEngagement with the previous engagement storage, an unordered_map keyed by the hashed names.
+//! The previous storage is no longer part of the engagement manager, and is reproduced here.
+Sample FindEngagementHashedKey(std::size_t aSize)
+{
+   auto                     platformCount = GetPlatformCount(aSize);
+   std::vector<std::string> attackTypes;
+   for (std::size_t i = 0U; i < cATTACK_TYPE_COUNT; ++i)
+   {
+      attackTypes.push_back(GetAttackTypeName(i));
+   }
+   std::vector<std::string> platforms;
+   for (std::size_t i = 0U; i < platformCount; ++i)
+   {
+      platforms.push_back(GetPlatformName(i));
+   }
+
+   auto getKey = [&](std::size_t aIndex)
+   {
+      auto indices = GetEngagementIndices(aIndex, platformCount);
+      return GetHashedKey(attackTypes[indices.mAttackType], platforms[indices.mAttacker], platforms[indices.mVictim]);
+   };
+
+   std::unordered_map<std::size_t, EngagementRecord> engagements;
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      auto key              = getKey(i);
+      engagements[key].mKey = key;
+   }
+
+   std::vector<std::size_t> order(aSize);
+   std::iota(order.begin(), order.end(), std::size_t{0U});
+   std::shuffle(order.begin(), order.end(), std::mt19937_64{1U});
+
+   std::size_t found = 0U;
+   auto        start = Clock::now();
+   for (auto i : order)
+   {
+      found += (engagements.find(getKey(i)) != std::end(engagements)) ? 1U : 0U;
+   }
+   auto seconds = GetSeconds(start);
+   sSink        = found;
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+Sample CullEngagements(WsfApplication& aApplication, std::size_t aSize)
+{
+   StandInSimulation standIn(aApplication, aSize);
+   standIn.Scan();
+   auto& manager = standIn.GetManager();
+
+   auto start = Clock::now();
+   for (auto victimId : standIn.GetPlatformIds())
+   {
+      manager.CullVictimEngagements(victimId);
+   }
+   return Sample{GetSeconds(start), aSize};
+}
+
+// =================================================================================================
+//! Each engagement is added by an untimed scan, and is then attacked. Scheduled phases are included,
+//! such that each attack is timed to completion.
+Sample CyberAttack(WsfApplication& aApplication, std::size_t aSize, bool aDelayed)
+{
+   StandInSimulation standIn(aApplication, aSize, aDelayed);
+   standIn.Scan();
+   auto& manager    = standIn.GetManager();
+   auto& simulation = standIn.GetSimulation();
+
+   std::size_t attacked = 0U;
+   auto        start    = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      const auto& ids = standIn.GetEngagementIds(i);
+      attacked += manager.CyberAttack(ids.mAttackTypeId, ids.mAttackerId, ids.mVictimId, simulation) ? 1U : 0U;
+   }
+   standIn.Run();
+   auto seconds = GetSeconds(start);
+   sSink        = attacked;
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+// Attacker resource checks. Before attack type information was resolved once per simulation, each
+// check copied the scenario extension (whose type lists are held by pointer) and searched its
+// attack types by name. The check now reads the resolved attack type information of the engagement.
+// =================================================================================================
+
+//! The number of attack types in the scenario.
+constexpr std::size_t cRESOURCE_ATTACK_TYPE_COUNT = 64U;
+
+struct AttackTypeStandIn
+{
+   std::string mName;
+   double      mResourceRequirements;
+};
+
+using AttackTypeList = std::map<std::string, std::unique_ptr<AttackTypeStandIn>>;
+
+//! Stand-in for the scenario extension, holding its type lists by pointer.
+struct ScenarioStandIn
+{
+   std::shared_ptr<AttackTypeList> mAttackTypes;
+   std::shared_ptr<AttackTypeList> mConstraintTypes;
+   std::shared_ptr<AttackTypeList> mEffectTypes;
+   std::shared_ptr<AttackTypeList> mProtectTypes;
+};
+
+//! The attack type name and resolved attack type information of each engagement.
+struct ResourceCheckSetup
+{
+   explicit ResourceCheckSetup(std::size_t aSize)
+   {
+      mScenario.mAttackTypes     = std::make_shared<AttackTypeList>();
+      mScenario.mConstraintTypes = std::make_shared<AttackTypeList>();
+      mScenario.mEffectTypes     = std::make_shared<AttackTypeList>();
+      mScenario.mProtectTypes    = std::make_shared<AttackTypeList>();
+      for (std::size_t i = 0U; i < cRESOURCE_ATTACK_TYPE_COUNT; ++i)
+      {
+         auto name = "attack_type_" + std::to_string(i);
+         std::unique_ptr<AttackTypeStandIn> attackTypePtr(new AttackTypeStandIn{name, static_cast<double>(i % 8U)});
+         mScenario.mAttackTypes->emplace(name, std::move(attackTypePtr));
+      }
+
+      std::mt19937_64 generator{1U};
+      for (std::size_t i = 0U; i < aSize; ++i)
+      {
+         auto typeIt = mScenario.mAttackTypes->begin();
+         std::advance(typeIt, generator() % cRESOURCE_ATTACK_TYPE_COUNT);
+         mNames.push_back(typeIt->first);
+         mInfo.push_back(typeIt->second.get());
+         mResources.push_back(static_cast<double>(generator() % 8U));
+      }
+   }
+
+   ScenarioStandIn                 mScenario;
+   std::vector<std::string>        mNames;
+   std::vector<AttackTypeStandIn*> mInfo;
+   std::vector<double>             mResources;
+};
+
+// =================================================================================================
+Sample ResourceCheckScenarioLookup(std::size_t aSize)
+{
+   ResourceCheckSetup setup(aSize);
+
+   std::size_t met   = 0U;
+   auto        start = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      auto cyberScenario = setup.mScenario;
+      auto attackType    = cyberScenario.mAttackTypes->find(setup.mNames[i])->second.get();
+      met += (setup.mResources[i] >= attackType->mResourceRequirements) ? 1U : 0U;
+   }
+   auto seconds = GetSeconds(start);
+   sSink        = met;
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+Sample ResourceCheckResolved(std::size_t aSize)
+{
+   ResourceCheckSetup setup(aSize);
+
+   std::size_t met   = 0U;
+   auto        start = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      met += (setup.mResources[i] >= setup.mInfo[i]->mResourceRequirements) ? 1U : 0U;
+   }
+   auto seconds = GetSeconds(start);
+   sSink        = met;
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+// Event scheduling. The standalone host event queue stands in for the simulation event queue.
+// =================================================================================================
+
+wsf::cyber::kernel::Parameters GetParameters(bool aDelayed)
+{
+   wsf::cyber::kernel::Parameters parameters;
+   parameters.mThresholds = {{0.5, 0.6, 0.3, 0.2, 0.5, 0.7, 0.1}};
+   if (aDelayed)
+   {
+      parameters.mScanDelay      = 2.0;
+      parameters.mDeliveryDelay  = 1.0;
+      parameters.mDetectionDelay = 5.0;
+      parameters.mRecoveryDelay  = 3.0;
+      parameters.mDuration       = 10.0;
+   }
+   return parameters;
+}
+
+// =================================================================================================
+Sample ScheduleEvents(std::size_t aSize)
+{
+   wsf::cyber::kernel::StandaloneHost host(1U);
+   auto&                              kernel = host.GetKernel();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      kernel.Add(0U, i + 1U, i, GetParameters(true));
+   }
+
+   std::mt19937_64                        generator{1U};
+   std::uniform_real_distribution<double> time(0.0, 1000.0);
+   std::vector<double>                    times(aSize);
+   std::generate(times.begin(), times.end(), [&]() { return time(generator); });
+
+   auto start = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      host.Schedule(times[i], wsf::cyber::kernel::Phase::cATTACK_RECOVERY_DELAY, i);
+   }
+   return Sample{GetSeconds(start), aSize};
+}
+
+// =================================================================================================
+Sample ScheduleTimingWheel(std::size_t aSize)
+{
+   wsf::cyber::TimingWheel                wheel;
+   std::mt19937_64                        generator{1U};
+   std::uniform_real_distribution<double> time(0.0, 1000.0);
+   std::vector<double>                    times(aSize);
+   std::generate(times.begin(), times.end(), [&]() { return time(generator); });
+
+   // Insert every delay, then dispatch them in the order of the simulation, as the event manager does.
+   std::vector<wsf::cyber::TimingWheel::Record> records;
+   records.reserve(aSize);
+   auto start = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      wheel.Insert(times[i], 0U, i, i);
+   }
+   while (!wheel.IsEmpty())
+   {
+      wheel.PopDue(wheel.GetNextTime(), records);
+   }
+   return Sample{GetSeconds(start), aSize};
+}
+
+// =================================================================================================
+// Cancellation churn. Pending delays are canceled and replaced while time advances. A canceled
+// event remains in the simulation event queue until its time (modeled here by a priority queue of
+// tombstones), whereas a canceled delay is removed from the timing wheel.
+// =================================================================================================
+
+//! The number of delays canceled and replaced between advances of time (by one second).
+constexpr std::size_t cCHURN_BATCH = 1000U;
+
+//! The pending delays of the churn cases, by identifier.
+class PendingDelays
+{
+public:
+   explicit PendingDelays(std::size_t aSize)
+   {
+      mIds.reserve(aSize);
+      mPositions.reserve(2U * aSize);
+   }
+
+   std::size_t Add()
+   {
+      auto id = mPositions.size();
+      mPositions.push_back(mIds.size());
+      mIds.push_back(id);
+      return id;
+   }
+
+   //! Replaces a random pending delay, returning the identifiers of the replaced and new delays.
+   std::pair<std::size_t, std::size_t> Replace(std::mt19937_64& aGenerator)
+   {
+      auto position = std::uniform_int_distribution<std::size_t>(0U, mIds.size() - 1U)(aGenerator);
+      auto previous = mIds[position];
+      auto id       = mPositions.size();
+      mPositions.push_back(position);
+      mPositions[previous] = cNONE;
+      mIds[position]       = id;
+      return std::make_pair(previous, id);
+   }
+
+   //! Removes a delay, returning false if it was replaced.
+   bool Remove(std::size_t aId)
+   {
+      auto position = mPositions[aId];
+      if (position == cNONE)
+      {
+         return false;
+      }
+      mIds[position]             = mIds.back();
+      mPositions[mIds[position]] = position;
+      mIds.pop_back();
+      mPositions[aId] = cNONE;
+      return true;
+   }
+
+   bool IsEmpty() const { return mIds.empty(); }
+
+private:
+   static constexpr std::size_t cNONE = std::numeric_limits<std::size_t>::max();
+
+   std::vector<std::size_t> mIds;
+   std::vector<std::size_t> mPositions;
+};
+
+constexpr std::size_t PendingDelays::cNONE;
+
+// =================================================================================================
+Sample CancelChurnEvents(std::size_t aSize)
+{
+   using QueuedEvent = std::pair<double, std::size_t>;
+
+   std::priority_queue<QueuedEvent, std::vector<QueuedEvent>, std::greater<QueuedEvent>> queue;
+   PendingDelays                                                                         pending(aSize);
+   std::mt19937_64                                                                       generator{1U};
+   std::uniform_real_distribution<double>                                                delay(0.0, 1000.0);
+
+   std::size_t peakSize = 0U;
+   double      now      = 0.0;
+   auto        start    = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      queue.emplace(delay(generator), pending.Add());
+   }
+   for (std::size_t i = 0U; (i < aSize) && !pending.IsEmpty(); ++i)
+   {
+      // The replaced event is only flagged as canceled, and remains queued.
+      auto ids = pending.Replace(generator);
+      queue.emplace(now + delay(generator), ids.second);
+      peakSize = std::max(peakSize, queue.size());
+      if ((i + 1U) % cCHURN_BATCH == 0U)
+      {
+         now += 1.0;
+         while (!queue.empty() && (queue.top().first <= now))
+         {
+            pending.Remove(queue.top().second);
+            queue.pop();
+         }
+      }
+   }
+   auto seconds = GetSeconds(start);
+   return Sample{seconds, aSize, peakSize};
+}
+
+// =================================================================================================
+Sample CancelChurnTimingWheel(std::size_t aSize)
+{
+   wsf::cyber::TimingWheel                      wheel;
+   std::vector<wsf::cyber::TimingWheel::Handle> handles;
+   std::vector<wsf::cyber::TimingWheel::Record> records;
+   PendingDelays                                pending(aSize);
+   std::mt19937_64                              generator{1U};
+   std::uniform_real_distribution<double>       delay(0.0, 1000.0);
+   handles.reserve(2U * aSize);
+
+   std::size_t peakSize = 0U;
+   double      now      = 0.0;
+   auto        start    = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      auto id = pending.Add();
+      handles.push_back(wheel.Insert(delay(generator), 0U, 0U, id));
+   }
+   for (std::size_t i = 0U; (i < aSize) && !pending.IsEmpty(); ++i)
+   {
+      auto ids = pending.Replace(generator);
+      wheel.Cancel(handles[ids.first]);
+      handles.push_back(wheel.Insert(now + delay(generator), 0U, 0U, ids.second));
+      peakSize = std::max(peakSize, wheel.GetSize());
+      if ((i + 1U) % cCHURN_BATCH == 0U)
+      {
+         now += 1.0;
+         records.clear();
+         wheel.PopDue(now, records);
+         for (const auto& record : records)
+         {
+            pending.Remove(record.mKey);
+         }
+      }
+   }
+   auto seconds = GetSeconds(start);
+   return Sample{seconds, aSize, peakSize};
+}
+
+// =================================================================================================
+// Event manager. The real EventManager, hosted by a stand-in for the simulation event queue.
+// =================================================================================================
+
+//! A stand-in for the simulation, scheduling the events of the event manager in a queue ordered
+//! by time. As in the simulation, a canceled event remains queued until its time.
+class EventQueueHost : public wsf::cyber::EventManager::Host
+{
+public:
+   void AddEvent(std::unique_ptr<WsfEvent> aEventPtr) override
+   {
+      auto eventTime = aEventPtr->GetTime();
+      mQueue.push_back(QueuedEvent{eventTime, mSequence++, std::move(aEventPtr)});
+      std::push_heap(mQueue.begin(), mQueue.end(), IsLater);
+      mPeakSize = std::max(mPeakSize, mQueue.size());
+   }
+
+   void Dispatch(wsf::cyber::Event::Type aEventType, std::size_t aVictimId, std::size_t aKey) override
+   {
+      ++mDispatchCount;
+   }
+
+   void Cancel(std::size_t aKey) override { ++mCancelCount; }
+
+   //! Executes the events due at or before the time, as the simulation would.
+   void AdvanceTime(double aSimTime, wsf::cyber::EventManager& aEventManager)
+   {
+      while (!mQueue.empty() && (mQueue.front().mTime <= aSimTime))
+      {
+         std::pop_heap(mQueue.begin(), mQueue.end(), IsLater);
+         auto eventPtr = std::move(mQueue.back().mEventPtr);
+         mQueue.pop_back();
+         if (!eventPtr->ShouldExecute())
+         {
+            continue;
+         }
+
+         // Other than the engagement events, the only event scheduled is the delay event of the timing
+         // wheel, which is executed here as it would be by the simulation.
+         auto cyberEventPtr = dynamic_cast<wsf::cyber::Event*>(eventPtr.get());
+         if (cyberEventPtr)
+         {
+            auto eventType = cyberEventPtr->GetType();
+            aEventManager.EndEvent((eventType != wsf::cyber::Event::Type::cSCAN_DELAY), cyberEventPtr->GetKey());
+            Dispatch(eventType, cyberEventPtr->GetVictimId(), cyberEventPtr->GetKey());
+         }
+         else
+         {
+            auto nextTime = aEventManager.DispatchDelays(eventPtr->GetTime());
+            if (nextTime != std::numeric_limits<double>::max())
+            {
+               eventPtr->SetTime(nextTime);
+               AddEvent(std::move(eventPtr));
+            }
+         }
+      }
+   }
+
+   std::size_t GetPeakSize() const { return mPeakSize; }
+   std::size_t GetDispatchCount() const { return mDispatchCount; }
+   std::size_t GetCancelCount() const { return mCancelCount; }
+
+private:
+   struct QueuedEvent
+   {
+      double                    mTime;
+      std::size_t               mSequence;
+      std::unique_ptr<WsfEvent> mEventPtr;
+   };
+
+   static bool IsLater(const QueuedEvent& aLhs, const QueuedEvent& aRhs)
+   {
+      return (aLhs.mTime > aRhs.mTime) || ((aLhs.mTime == aRhs.mTime) && (aLhs.mSequence > aRhs.mSequence));
+   }
+
+   std::vector<QueuedEvent> mQueue;
+   std::size_t              mSequence{0U};
+   std::size_t              mPeakSize{0U};
+   std::size_t              mDispatchCount{0U};
+   std::size_t              mCancelCount{0U};
+};
+
+//! The event manager and the host through which its events are queued.
+struct HostedEventManager
+{
+   HostedEventManager()
+      : mHostPtr(new EventQueueHost)
+      , mEventManager(std::unique_ptr<wsf::cyber::EventManager::Host>(mHostPtr))
+   {
+   }
+
+   EventQueueHost*          mHostPtr;
+   wsf::cyber::EventManager mEventManager;
+};
+
+std::vector<double> GetEventTimes(std::size_t aSize)
+{
+   std::mt19937_64                        generator{1U};
+   std::uniform_real_distribution<double> time(0.0, 1000.0);
+   std::vector<double>                    times(aSize);
+   std::generate(times.begin(), times.end(), [&]() { return time(generator); });
+   return times;
+}
+
+// =================================================================================================
+Sample EventManagerAddEvent(std::size_t aSize)
+{
+   HostedEventManager hosted;
+   auto               times = GetEventTimes(aSize);
+
+   auto start = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      hosted.mEventManager.AddEvent(
+         ut::make_unique<wsf::cyber::Event>(times[i], wsf::cyber::Event::Type::cATTACK_DELAY, i, i));
+   }
+   auto seconds = GetSeconds(start);
+   sSink        = hosted.mEventManager.GetEventCount();
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+Sample EventManagerCancelEvent(std::size_t aSize)
+{
+   HostedEventManager hosted;
+   auto               times = GetEventTimes(aSize);
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      hosted.mEventManager.AddEvent(
+         ut::make_unique<wsf::cyber::Event>(times[i], wsf::cyber::Event::Type::cATTACK_DELAY, i, i));
+   }
+
+   // Every event is canceled in a random order, and the canceled events are then discarded by the queue.
+   std::vector<std::size_t> keys(aSize);
+   std::iota(keys.begin(), keys.end(), std::size_t{0U});
+   std::shuffle(keys.begin(), keys.end(), std::mt19937_64{1U});
+
+   auto start = Clock::now();
+   for (auto key : keys)
+   {
+      hosted.mEventManager.CancelEvent(true, key);
+   }
+   hosted.mHostPtr->AdvanceTime(std::numeric_limits<double>::max(), hosted.mEventManager);
+   auto seconds = GetSeconds(start);
+   sSink        = hosted.mHostPtr->GetCancelCount() + hosted.mHostPtr->GetDispatchCount();
+   return Sample{seconds, aSize};
+}
+
+// =================================================================================================
+//! Adds a delay for each engagement, and then advances time until every delay has been dispatched.
+Sample EventManagerAddDelay(std::size_t aSize, bool aTimingWheel)
+{
+   HostedEventManager hosted;
+   auto               times = GetEventTimes(aSize);
+   if (!aTimingWheel)
+   {
+      hosted.mEventManager.DisableTimingWheel();
+   }
+
+   auto start = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      hosted.mEventManager.AddDelay(times[i], wsf::cyber::Event::Type::cATTACK_DELAY, i, i);
+   }
+   for (double now = 1.0; hosted.mEventManager.GetEventCount() > 0U; now += 1.0)
+   {
+      hosted.mHostPtr->AdvanceTime(now, hosted.mEventManager);
+   }
+   auto seconds = GetSeconds(start);
+   sSink        = hosted.mHostPtr->GetDispatchCount();
+   return Sample{seconds, aSize, hosted.mHostPtr->GetPeakSize()};
+}
+
+// =================================================================================================
+//! Cancels the delays of a fixed number of victims, each with the same number of delays, such that the
+//! cost per delay canceled is independent of the total number of delays.
+Sample EventManagerCancelEvents(std::size_t aSize)
+{
+   constexpr std::size_t cDELAYS_PER_VICTIM = 4U;
+
+   HostedEventManager hosted;
+   auto               times = GetEventTimes(aSize);
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      hosted.mEventManager.AddDelay(times[i], wsf::cyber::Event::Type::cATTACK_DELAY, i / cDELAYS_PER_VICTIM, i);
+   }
+
+   auto        victims  = std::min<std::size_t>(1000U, aSize / cDELAYS_PER_VICTIM);
+   std::size_t canceled = 0U;
+   auto        start    = Clock::now();
+   for (std::size_t victimId = 0U; victimId < victims; ++victimId)
+   {
+      canceled += hosted.mEventManager.CancelEvents(victimId);
+   }
+   return Sample{GetSeconds(start), canceled};
+}
+
+// =================================================================================================
+// Constraint attack history
+// =================================================================================================
+
+Sample AddAttackTime(std::size_t aSize)
+{
+   wsf::cyber::Constraint constraint;
+   WsfStringId            attackType("benchmark_attack");
+
+   auto start = Clock::now();
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      constraint.AddAttackTime(attackType, static_cast<double>(i));
+   }
+   return Sample{GetSeconds(start), aSize};
+}
+
+// =================================================================================================
+Sample GetAttackCountAfterTime(std::size_t aSize)
+{
+   wsf::cyber::Constraint constraint;
+   WsfStringId            attackType("benchmark_attack");
+   for (std::size_t i = 0U; i < aSize; ++i)
+   {
+      constraint.AddAttackTime(attackType, static_cast<double>(i));
+   }
+
+   //! The query cost grows with the number of attacks after the time, so the number of queries is
+   //! reduced with size to bound the run time at the largest size.
+   std::size_t queries = std::min(aSize, std::max<std::size_t>(10U, 10000000U / aSize));
+
+   std::mt19937_64                        generator{1U};
+   std::uniform_real_distribution<double> time(0.0, static_cast<double>(aSize));
+   std::vector<double>                    times(queries);
+   std::generate(times.begin(), times.end(), [&]() { return time(generator); });
+
+   std::size_t count = 0U;
+   auto        start = Clock::now();
+   for (auto queryTime : times)
+   {
+      count += constraint.GetAttackCountAfterTime(attackType, queryTime);
+   }
+   auto seconds = GetSeconds(start);
+   sSink        = count;
+   return Sample{seconds, queries};
+}
+
+// =================================================================================================
+void WriteJson(std::ostream& aStream, const std::vector<Result>& aResults, unsigned int aRepetitions)
+{
+   aStream << "{\n  \"repetitions\": " << aRepetitions << ",\n  \"benchmarks\": [";
+   for (std::size_t i = 0U; i < aResults.size(); ++i)
+   {
+      const auto& result = aResults[i];
+      aStream << ((i == 0U) ? "\n" : ",\n") << "    {\"name\": \"" << result.mName << "\", \"size\": " << result.mSize
+              << ", \"operations\": " << result.mSample.mOperations << ", \"seconds\": " << result.mSample.mSeconds
+              << ", \"ns_per_operation\": " << (1.0e9 * result.mSample.mSeconds / result.mSample.mOperations);
+      if (result.mSample.mPeakQueueSize > 0U)
+      {
+         aStream << ", \"peak_queue_size\": " << result.mSample.mPeakQueueSize;
+      }
+      aStream << "}";
+   }
+   aStream << "\n  ]\n}\n";
+}
+} // namespace
+
+// =================================================================================================
+int main(int argc, char* argv[])
+{
+   std::size_t  maxSize     = 1000000U;
+   unsigned int repetitions = 3U;
+   std::string  outputFile;
+   for (int i = 1; i < argc; ++i)
+   {
+      std::string argument(argv[i]);
+      if ((argument == "--max-size") && (i + 1 < argc))
+      {
+         maxSize = std::strtoull(argv[++i], nullptr, 10);
+      }
+      else if ((argument == "--repetitions") && (i + 1 < argc))
+      {
+         repetitions = std::max(1U, static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+      }
+      else if ((argument == "--output") && (i + 1 < argc))
+      {
+         outputFile = argv[++i];
+      }
+      else
+      {
+         std::cerr << "Usage: " << argv[0] << " [--max-size N] [--repetitions N] [--output FILE]\n";
+         return 1;
+      }
+   }
+
+   //! The stand-in simulations require an application with the cyber extension registered.
+   WsfStandardApplication application("wsf_cyber_benchmark", argc, argv);
+   WSF_REGISTER_EXTENSION(application, wsf_cyber);
+
+   const std::vector<std::pair<std::string, Case>> cases{
+      {"AddEngagement", [&](std::size_t aSize) { return AddEngagement(application, aSize); }},
+      {"CyberScan", [&](std::size_t aSize) { return CyberScan(application, aSize); }},
+      {"FindEngagement", [&](std::size_t aSize) { return FindEngagement(application, aSize); }},
+      {"FindEngagementHashedKey", FindEngagementHashedKey},
+      {"CullEngagements", [&](std::size_t aSize) { return CullEngagements(application, aSize); }},
+      {"ResourceCheckScenarioLookup", ResourceCheckScenarioLookup},
+      {"ResourceCheckResolved", ResourceCheckResolved},
+      {"CyberAttack", [&](std::size_t aSize) { return CyberAttack(application, aSize, false); }},
+      {"CyberAttackDelayed", [&](std::size_t aSize) { return CyberAttack(application, aSize, true); }},
+      {"ScheduleEvents", ScheduleEvents},
+      {"ScheduleTimingWheel", ScheduleTimingWheel},
+      {"CancelChurnEvents", CancelChurnEvents},
+      {"CancelChurnTimingWheel", CancelChurnTimingWheel},
+      {"EventManager::AddEvent", EventManagerAddEvent},
+      {"EventManager::CancelEvent", EventManagerCancelEvent},
+      {"EventManager::AddDelay", [](std::size_t aSize) { return EventManagerAddDelay(aSize, true); }},
+      {"EventManager::AddDelayEvents", [](std::size_t aSize) { return EventManagerAddDelay(aSize, false); }},
+      {"EventManager::CancelEvents", EventManagerCancelEvents},
+      {"Constraint::AddAttackTime", AddAttackTime},
+      {"Constraint::GetAttackCountAfterTime", GetAttackCountAfterTime}};
+
+   std::vector<Result> results;
+   for (std::size_t size : {100U, 10000U, 1000000U})
+   {
+      if (size > maxSize)
+      {
+         break;
+      }
+
+      for (const auto& benchmark : cases)
+      {
+         Sample best{std::numeric_limits<double>::max(), 0U};
+         for (unsigned int repetition = 0U; repetition < repetitions; ++repetition)
+         {
+            Sample sample{0.0, 0U};
+            try
+            {
+               sample = benchmark.second(size);
+            }
+            catch (const std::exception& aException)
+            {
+               std::cerr << "Benchmark " << benchmark.first << " failed: " << aException.what() << '\n';
+               return 1;
+            }
+            if (sample.mSeconds < best.mSeconds)
+            {
+               best = sample;
+            }
+         }
+         results.push_back(Result{benchmark.first, size, best});
+      }
+   }
+
+   if (outputFile.empty())
+   {
+      WriteJson(std::cout, results, repetitions);
+   }
+   else
+   {
+      std::ofstream stream(outputFile);
+      if (!stream)
+      {
+         std::cerr << "Unable to open output file: " << outputFile << '\n';
+         return 1;
+      }
+      WriteJson(stream, results, repetitions);
+   }
+   return 0;
+}